@@ -0,0 +1,211 @@
+/*
+ * Times the lexer over one input file. Built once per table encoding by
+ * `make bench`, which links it against each generated transition table.
+ *
+ * Two loops are timed. The match loop only runs dfa_match() over the input
+ * and looks up the type of each token, which is the part the encoding and
+ * keyword mode change. The lex loop runs lexer_lex(), which also fills the
+ * token buffer, once plainly and, for the table encodings, once memoized.
+ *
+ * Both token streams are also hashed, each token by its type name, offset
+ * and length, and the hashes printed on the checksum line. `make bench`
+ * fails unless every build prints the same line as the dense one.
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "lexer.h"
+
+static double now(void)
+{
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+static char *read_file(const char *filename, size_t *size)
+{
+        FILE *file = fopen(filename, "rb");
+        if (!file) {
+                perror("Failed to open input file");
+                return NULL;
+        }
+
+        fseek(file, 0, SEEK_END);
+        long file_size = ftell(file);
+        fseek(file, 0, SEEK_SET);
+
+        char *buffer = (char *)malloc((size_t)file_size + 1);
+        if (!buffer) {
+                perror("Failed to allocate input buffer");
+                fclose(file);
+                return NULL;
+        }
+
+        *size = fread(buffer, 1, (size_t)file_size, file);
+        buffer[*size] = '\0';
+        fclose(file);
+        return buffer;
+}
+
+#define CHECKSUM_SEED 14695981039346656037ULL
+
+/* 64-bit FNV-1a of size bytes of data, continuing from hash */
+static uint64_t fnv1a(uint64_t hash, const void *data, size_t size)
+{
+        const unsigned char *bytes = (const unsigned char *)data;
+        for (size_t i = 0; i < size; i++)
+                hash = (hash ^ bytes[i]) * 1099511628211ULL;
+        return hash;
+}
+
+/*
+ * adds a token to hash. the type goes in by name, so builds that number the
+ * types differently still agree
+ */
+static uint64_t checksum_token(uint64_t hash,
+                               TokenType type,
+                               uint64_t offset,
+                               uint64_t length)
+{
+        const char *name = tok_type_to_str(type);
+        hash = fnv1a(hash, name, strlen(name) + 1);
+        hash = fnv1a(hash, &offset, sizeof(offset));
+        return fnv1a(hash, &length, sizeof(length));
+}
+
+static uint64_t checksum_tokens(const struct TokenBuffer *tokens)
+{
+        uint64_t hash = CHECKSUM_SEED;
+        for (size_t i = 0; i < tokens->size; i++)
+                hash = checksum_token(hash,
+                                      tokens->kinds[i],
+                                      tokens->offsets[i],
+                                      tokens->lengths[i]);
+        return hash;
+}
+
+/*
+ * tokens matched by one pass of dfa_match() over the whole source, the ones
+ * that are identifiers are counted in *identifiers. bytes no token matches
+ * count as UNKNOWN tokens of length 0
+ */
+static size_t match_all(const char *source,
+                        size_t size,
+                        size_t *identifiers,
+                        uint64_t *checksum)
+{
+        size_t tokens = 0;
+        size_t pos = 0;
+
+        *identifiers = 0;
+        *checksum = CHECKSUM_SEED;
+        while (pos < size) {
+                int accept_state;
+                size_t length =
+                    dfa_match(&source[pos], size - pos, &accept_state);
+                TokenType type = UNKNOWN;
+                if (length > 0) {
+                        type = STATE_TOKEN_TYPE[accept_state];
+#ifdef TABLE_KEYWORDS
+                        type = keyword_type(type, &source[pos], length);
+#endif
+                        *identifiers += type == IDENTIFIER;
+                }
+                *checksum = checksum_token(*checksum, type, pos, length);
+                pos += length > 0 ? length : 1;
+                tokens++;
+        }
+
+        return tokens;
+}
+
+/*
+ * best time of runs lexer_lex() calls over source, the tokens of the last
+ * one are hashed into *checksum
+ */
+static double time_lex(char *source,
+                       size_t size,
+                       int runs,
+                       int memoize,
+                       uint64_t *checksum)
+{
+        double best = 1e30;
+        for (int i = 0; i < runs; i++) {
+                struct Lexer lexer;
+                if (lexer_init(&lexer, source, size) != 0) {
+                        perror("Failed to create lexer");
+                        exit(EXIT_FAILURE);
+                }
+                lexer.memoize = memoize;
+
+                double start = now();
+                lexer_lex(&lexer);
+                double elapsed = now() - start;
+                if (elapsed < best)
+                        best = elapsed;
+                *checksum = checksum_tokens(&lexer.tokens);
+
+                // so later runs don't pay for the memory of earlier ones
+                lexer_destroy(&lexer);
+        }
+        return best;
+}
+
+int main(int argc, char *argv[])
+{
+        if (argc < 2) {
+                fprintf(stderr, "Usage: %s <input_file> [runs]\n", argv[0]);
+                return EXIT_FAILURE;
+        }
+
+        int runs = argc > 2 ? atoi(argv[2]) : 5;
+        size_t size;
+        char *source = read_file(argv[1], &size);
+        if (!source)
+                return EXIT_FAILURE;
+
+        double best_match = 1e30;
+        size_t tokens = 0;
+        size_t identifiers = 0;
+        uint64_t match_checksum = 0;
+        for (int i = 0; i < runs; i++) {
+                double start = now();
+                tokens = match_all(source, size, &identifiers, &match_checksum);
+                double elapsed = now() - start;
+                if (elapsed < best_match)
+                        best_match = elapsed;
+        }
+
+        uint64_t lex_checksum = 0;
+        double best_lex = time_lex(source, size, runs, 0, &lex_checksum);
+
+        double mb = (double)size / (1024.0 * 1024.0);
+        printf("%zu bytes, %zu tokens, %zu identifiers, best of %d runs\n",
+               size,
+               tokens,
+               identifiers,
+               runs);
+        printf("  match: %8.2f ms %8.1f MB/s\n",
+               best_match * 1e3,
+               mb / best_match);
+        printf("  lex:   %8.2f ms %8.1f MB/s\n", best_lex * 1e3, mb / best_lex);
+#ifndef TABLE_ENCODING_DIRECT
+        uint64_t memo_checksum = 0;
+        double best_memo = time_lex(source, size, runs, 1, &memo_checksum);
+        printf("  memo:  %8.2f ms %8.1f MB/s\n", best_memo * 1e3, mb / best_memo);
+        if (memo_checksum != lex_checksum) {
+                fprintf(stderr, "memoized lexing produced other tokens\n");
+                free(source);
+                return EXIT_FAILURE;
+        }
+#endif
+        printf("checksum: match %016llx, lex %016llx\n",
+               (unsigned long long)match_checksum,
+               (unsigned long long)lex_checksum);
+
+        free(source);
+        return EXIT_SUCCESS;
+}
@@ -0,0 +1,53 @@
+#include <stdlib.h>
+#include "arena.h"
+
+/* smallest block, larger ones are allocated for larger requests */
+#define ARENA_BLOCK_SIZE (64 * 1024)
+
+struct ArenaBlock {
+        struct ArenaBlock *next;
+        size_t size;
+        size_t used;
+        max_align_t data[];
+};
+
+void arena_init(struct Arena *arena)
+{
+        arena->head = NULL;
+}
+
+void *arena_alloc(struct Arena *arena, size_t size)
+{
+        size_t align = sizeof(max_align_t);
+        size = (size + align - 1) / align * align;
+
+        struct ArenaBlock *block = arena->head;
+        if (!block || block->size - block->used < size) {
+                size_t block_size = size > ARENA_BLOCK_SIZE ? size
+                                                            : ARENA_BLOCK_SIZE;
+                block = (struct ArenaBlock *)malloc(sizeof(*block) +
+                                                    block_size);
+                if (!block)
+                        return NULL;
+
+                block->next = arena->head;
+                block->size = block_size;
+                block->used = 0;
+                arena->head = block;
+        }
+
+        void *p = (char *)block->data + block->used;
+        block->used += size;
+        return p;
+}
+
+void arena_destroy(struct Arena *arena)
+{
+        struct ArenaBlock *block = arena->head;
+        while (block) {
+                struct ArenaBlock *next = block->next;
+                free(block);
+                block = next;
+        }
+        arena->head = NULL;
+}
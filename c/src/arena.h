@@ -0,0 +1,35 @@
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <stddef.h>
+
+/**
+ * Bump allocator. Allocations are carved out of large blocks and are never
+ * freed one by one, only all at once by arena_destroy().
+ *
+ * Members:
+ * - head: The block being carved, which links to the earlier ones, or NULL
+ * before the first allocation.
+ */
+struct Arena {
+        struct ArenaBlock *head;
+};
+
+/**
+ * Initializes an empty arena, which allocates nothing until it is first
+ * used.
+ */
+void arena_init(struct Arena *arena);
+
+/**
+ * Returns size bytes aligned for any type, or NULL if a new block can't be
+ * allocated.
+ */
+void *arena_alloc(struct Arena *arena, size_t size);
+
+/**
+ * Frees every allocation of the arena and leaves it empty.
+ */
+void arena_destroy(struct Arena *arena);
+
+#endif
@@ -79,19 +79,6 @@ ASTNode *stmt_list_get(StmtListNode *list, size_t idx)
 }
 
 /* helper functions */
-static char *strdup_safe(const char *str)
-{
-        if (!str)
-                return NULL;
-        char *dup = malloc(strlen(str) + 1);
-        if (!dup) {
-                fprintf(stderr, "malloc failed in strdup_safe\n");
-                return NULL;
-        }
-        strcpy(dup, str);
-        return dup;
-}
-
 static ASTNode *node_base_create(NodeType type)
 {
         ASTNode *node = malloc(sizeof(ASTNode));
@@ -139,13 +126,8 @@ ASTNode *node_decl_create(DataType type, char *ident, ASTNode *init)
         }
 
         decl->type = type;
-        decl->ident = strdup_safe(ident);
+        decl->ident = ident;
         decl->init_expr = init;
-        if (!decl->ident) {
-                free(decl);
-                free(node);
-                return NULL;
-        }
 
         node->data.decl = decl;
         return node;
@@ -173,15 +155,10 @@ ASTNode *node_assign_create(char *ident, ASTNode *expr)
                 return NULL;
         }
 
-        assign->ident = strdup_safe(ident);
+        assign->ident = ident;
         assign->expr = expr;
         assign->is_input = false;
         assign->input_prompt = NULL;
-        if (!assign->ident) {
-                free(assign);
-                free(node);
-                return NULL;
-        }
 
         node->data.assign = assign;
         return node;
@@ -209,17 +186,10 @@ ASTNode *node_input_assign_create(char *ident, char *prompt)
                 return NULL;
         }
 
-        assign->ident = strdup_safe(ident);
+        assign->ident = ident;
         assign->expr = NULL;
         assign->is_input = true;
-        assign->input_prompt = strdup_safe(prompt);
-        if (!assign->ident || !assign->input_prompt) {
-                free(assign->ident);
-                free(assign->input_prompt);
-                free(assign);
-                free(node);
-                return NULL;
-        }
+        assign->input_prompt = prompt;
 
         node->data.assign = assign;
         return node;
@@ -406,16 +376,6 @@ ASTNode *node_literal_create(DataType type, LiteralValue val)
         lit->type = type;
         lit->value = val;
 
-        // if string, ensure copy
-        if (type == TYPE_STRING && val.str_val) {
-                lit->value.str_val = strdup_safe(val.str_val);
-                if (!lit->value.str_val) {
-                        free(lit);
-                        free(node);
-                        return NULL;
-                }
-        }
-
         node->data.lit = lit;
         return node;
 }
@@ -439,12 +399,7 @@ ASTNode *node_ident_create(char *ident)
                 return NULL;
         }
 
-        ident_node->name = strdup_safe(ident);
-        if (!ident_node->name) {
-                free(ident_node);
-                free(node);
-                return NULL;
-        }
+        ident_node->name = ident;
 
         node->data.ident = ident_node;
         return node;
@@ -469,13 +424,8 @@ ASTNode *node_func_call_create(char *func_name, ArgNode *args)
                 return NULL;
         }
 
-        func_call->func_name = strdup_safe(func_name);
+        func_call->func_name = func_name;
         func_call->arg_list = args;
-        if (!func_call->func_name) {
-                free(func_call);
-                free(node);
-                return NULL;
-        }
 
         node->data.func_call = func_call;
         return node;
@@ -569,16 +519,13 @@ void ast_node_free(ASTNode *node)
                 break;
 
         case NODE_DECL:
-                free(node->data.decl->ident);
                 ast_node_free(node->data.decl->init_expr);
                 free(node->data.decl);
                 break;
 
         case NODE_ASSIGN:
         case NODE_INPUT:
-                free(node->data.assign->ident);
                 ast_node_free(node->data.assign->expr);
-                free(node->data.assign->input_prompt);
                 free(node->data.assign);
                 break;
 
@@ -621,19 +568,14 @@ void ast_node_free(ASTNode *node)
                 break;
 
         case NODE_LITERAL:
-                if (node->data.lit->type == TYPE_STRING) {
-                        free(node->data.lit->value.str_val);
-                }
                 free(node->data.lit);
                 break;
 
         case NODE_IDENT:
-                free(node->data.ident->name);
                 free(node->data.ident);
                 break;
 
         case NODE_FUNC_CALL:
-                free(node->data.func_call->func_name);
                 arg_list_free(node->data.func_call->arg_list);
                 free(node->data.func_call);
                 break;
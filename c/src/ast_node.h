@@ -169,6 +169,8 @@ struct ASTNode {
         size_t col;
 };
 
+// the names, prompts and string literals passed in are borrowed, not copied,
+// and ast_node_free leaves them alone. they must outlive the node
 ASTNode *node_program_create(StmtListNode *stmt_list);
 ASTNode *node_stmt_block_create(StmtListNode *stmts);
 ASTNode *node_decl_create(DataType type, char *ident, ASTNode *init);
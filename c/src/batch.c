@@ -0,0 +1,424 @@
+#include <dirent.h>
+#include <errno.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include "batch.h"
+#include "lexer.h"
+#include "lexer_report.h"
+#include "parser.h"
+#include "source_buffer.h"
+
+/* bytes a worker buffers per output before copying them out */
+#define BATCH_FLUSH_SIZE (1024 * 1024)
+
+static int sources_add(struct BatchSources *sources, char *path)
+{
+        if (sources->size == sources->capacity) {
+                size_t capacity = sources->capacity ? 2 * sources->capacity
+                                                    : 64;
+                char **grown = (char **)realloc(sources->paths,
+                                                capacity * sizeof(char *));
+                if (!grown) {
+                        free(path);
+                        return -1;
+                }
+                sources->paths = grown;
+                sources->capacity = capacity;
+        }
+
+        sources->paths[sources->size++] = path;
+        return 0;
+}
+
+static int is_source_name(const char *name)
+{
+        size_t length = strlen(name);
+        return length > 3 && strcmp(name + length - 3, ".ai") == 0;
+}
+
+static int compare_paths(const void *a, const void *b)
+{
+        return strcmp(*(char *const *)a, *(char *const *)b);
+}
+
+static int collect_directory(struct BatchSources *sources, const char *dir)
+{
+        DIR *d = opendir(dir);
+        if (!d)
+                return -1;
+
+        size_t dir_length = strlen(dir);
+        const char *separator = dir[dir_length - 1] == '/' ? "" : "/";
+        int result = 0;
+        struct dirent *entry;
+        while (result == 0 && (entry = readdir(d)) != NULL) {
+                // skips . and .. along with hidden entries like .git
+                if (entry->d_name[0] == '.')
+                        continue;
+
+                size_t size = dir_length + strlen(entry->d_name) + 2;
+                char *path = (char *)malloc(size);
+                if (!path) {
+                        result = -1;
+                        break;
+                }
+                snprintf(path, size, "%s%s%s", dir, separator, entry->d_name);
+
+                int is_dir = entry->d_type == DT_DIR;
+                int is_file = entry->d_type == DT_REG;
+                struct stat st;
+                if (entry->d_type == DT_UNKNOWN && lstat(path, &st) == 0) {
+                        is_dir = S_ISDIR(st.st_mode);
+                        is_file = S_ISREG(st.st_mode);
+                }
+                // a link is followed to a file but not to a directory, which
+                // could lead back up the tree
+                if (entry->d_type == DT_LNK && stat(path, &st) == 0)
+                        is_file = S_ISREG(st.st_mode);
+
+                if (is_dir) {
+                        result = collect_directory(sources, path);
+                } else if (is_file && is_source_name(entry->d_name)) {
+                        result = sources_add(sources, path);
+                        path = NULL;
+                }
+                free(path);
+        }
+
+        int saved = errno;
+        closedir(d);
+        errno = saved;
+        return result;
+}
+
+static int collect_list(struct BatchSources *sources, const char *path)
+{
+        int standard_input = strcmp(path, "-") == 0;
+        FILE *list = standard_input ? stdin : fopen(path, "r");
+        if (!list)
+                return -1;
+
+        char *line = NULL;
+        size_t capacity = 0;
+        ssize_t length;
+        int result = 0;
+        while (result == 0 && (length = getline(&line, &capacity, list)) > 0) {
+                while (length > 0 &&
+                       (line[length - 1] == '\n' || line[length - 1] == '\r'))
+                        line[--length] = '\0';
+                if (length == 0)
+                        continue;
+
+                char *copy = strdup(line);
+                result = copy ? sources_add(sources, copy) : -1;
+        }
+        if (result == 0 && ferror(list))
+                result = -1;
+
+        int saved = errno;
+        free(line);
+        if (!standard_input)
+                fclose(list);
+        errno = saved;
+        return result;
+}
+
+int batch_sources_collect(struct BatchSources *sources, const char *path)
+{
+        sources->paths = NULL;
+        sources->size = 0;
+        sources->capacity = 0;
+
+        struct stat st;
+        if (strcmp(path, "-") != 0 && stat(path, &st) == 0 &&
+            S_ISDIR(st.st_mode)) {
+                int result = collect_directory(sources, path);
+                qsort(sources->paths,
+                      sources->size,
+                      sizeof(char *),
+                      compare_paths);
+                return result;
+        }
+
+        return collect_list(sources, path);
+}
+
+void batch_sources_destroy(struct BatchSources *sources)
+{
+        for (size_t i = 0; i < sources->size; i++)
+                free(sources->paths[i]);
+        free(sources->paths);
+
+        sources->paths = NULL;
+        sources->size = 0;
+        sources->capacity = 0;
+}
+
+/* what a worker has written to one of the outputs and not copied out yet */
+struct batch_output {
+        FILE *stream;
+        char *buffer;
+        size_t size;
+};
+
+/* sources a worker has yet to take, [next, end) */
+struct batch_share {
+        pthread_mutex_t lock;
+        size_t next;
+        size_t end;
+};
+
+struct batch_worker {
+        struct batch *batch;
+        unsigned id;
+        struct batch_share share;
+
+        struct batch_output symbols;
+        struct batch_output errors;
+        size_t failed;
+};
+
+struct batch {
+        const struct BatchSources *sources;
+        int memoize;
+
+        struct batch_worker *workers;
+        unsigned count;
+
+        pthread_mutex_t output_lock;
+        FILE *symbols;
+        FILE *errors;
+};
+
+static void output_open(struct batch_output *output)
+{
+        output->stream = open_memstream(&output->buffer, &output->size);
+        if (!output->stream) {
+                perror("Failed to open output buffer");
+                exit(EXIT_FAILURE);
+        }
+}
+
+/* copies output to file and empties it once it holds at least least bytes */
+static void output_flush(struct batch_output *output,
+                         FILE *file,
+                         pthread_mutex_t *lock,
+                         long least)
+{
+        if (ftell(output->stream) < least)
+                return;
+
+        fclose(output->stream);
+        pthread_mutex_lock(lock);
+        fwrite(output->buffer, 1, output->size, file);
+        pthread_mutex_unlock(lock);
+        free(output->buffer);
+        output_open(output);
+}
+
+static void output_close(struct batch_output *output, FILE *file)
+{
+        fclose(output->stream);
+        fwrite(output->buffer, 1, output->size, file);
+        free(output->buffer);
+}
+
+/*
+ * lexes and parses path into the worker's outputs, its errors go to errors.
+ * returns nonzero if it parsed
+ */
+static int batch_parse(struct batch_worker *worker,
+                       const char *path,
+                       FILE *errors)
+{
+        struct SourceBuffer source;
+        if (source_buffer_load(&source, path) != 0) {
+                fprintf(errors,
+                        "Failed to open source file: %s\n",
+                        strerror(errno));
+                return 0;
+        }
+
+        struct Lexer lexer;
+        if (lexer_init(&lexer, source.text, source.size) != 0) {
+                perror("Failed to lex source file");
+                exit(EXIT_FAILURE);
+        }
+        lexer.memoize = worker->batch->memoize;
+        if (lexer_lex(&lexer) != 0) {
+                perror("Failed to lex source file");
+                exit(EXIT_FAILURE);
+        }
+        fprintf(worker->symbols.stream, "==> %s <==\n", path);
+        lexer_print_toks(worker->symbols.stream, &lexer.tokens);
+
+        ASTNode *ast = parse_reporting(&lexer.tokens, errors);
+        int parsed = ast != NULL;
+        if (ast)
+                ast_node_free(ast);
+        else
+                fprintf(errors, "Parsing failed due to errors.\n");
+
+        lexer_destroy(&lexer);
+        source_buffer_release(&source);
+        return parsed;
+}
+
+static void batch_source(struct batch_worker *worker, const char *path)
+{
+        char *messages;
+        size_t size;
+        FILE *errors = open_memstream(&messages, &size);
+        if (!errors) {
+                perror("Failed to open output buffer");
+                exit(EXIT_FAILURE);
+        }
+
+        if (!batch_parse(worker, path, errors))
+                worker->failed++;
+        fclose(errors);
+
+        // every line of the source's errors is prefixed with its path
+        const char *line = messages;
+        const char *end = messages + size;
+        while (line < end) {
+                const char *newline = memchr(line, '\n', end - line);
+                int length = (int)((newline ? newline : end) - line);
+                fprintf(worker->errors.stream,
+                        "%s: %.*s\n",
+                        path,
+                        length,
+                        line);
+                line += length + 1;
+        }
+        free(messages);
+}
+
+/*
+ * takes the next source of the worker's share, or steals half of what is
+ * left of the first other share that has any. returns 0 when all are empty
+ */
+static int batch_take(struct batch_worker *worker, size_t *index)
+{
+        struct batch_share *own = &worker->share;
+        pthread_mutex_lock(&own->lock);
+        int taken = own->next < own->end;
+        if (taken)
+                *index = own->next++;
+        pthread_mutex_unlock(&own->lock);
+        if (taken)
+                return 1;
+
+        struct batch *batch = worker->batch;
+        for (unsigned i = 1; i < batch->count; i++) {
+                unsigned victim_id = (worker->id + i) % batch->count;
+                struct batch_share *victim = &batch->workers[victim_id].share;
+
+                // the back half, which its owner reaches last
+                pthread_mutex_lock(&victim->lock);
+                size_t stolen = (victim->end - victim->next + 1) / 2;
+                victim->end -= stolen;
+                size_t begin = victim->end;
+                pthread_mutex_unlock(&victim->lock);
+                if (stolen == 0)
+                        continue;
+
+                pthread_mutex_lock(&own->lock);
+                own->next = begin + 1;
+                own->end = begin + stolen;
+                pthread_mutex_unlock(&own->lock);
+                *index = begin;
+                return 1;
+        }
+        return 0;
+}
+
+static void *batch_work(void *arg)
+{
+        struct batch_worker *worker = (struct batch_worker *)arg;
+        struct batch *batch = worker->batch;
+
+        size_t index;
+        while (batch_take(worker, &index)) {
+                batch_source(worker, batch->sources->paths[index]);
+
+                output_flush(&worker->symbols,
+                             batch->symbols,
+                             &batch->output_lock,
+                             BATCH_FLUSH_SIZE);
+                output_flush(&worker->errors,
+                             batch->errors,
+                             &batch->output_lock,
+                             BATCH_FLUSH_SIZE);
+        }
+        return NULL;
+}
+
+size_t batch_run(const struct BatchSources *sources,
+                 unsigned workers,
+                 int memoize,
+                 FILE *symbols,
+                 FILE *errors)
+{
+        if (workers > sources->size)
+                workers = (unsigned)sources->size;
+        if (workers == 0)
+                workers = 1;
+
+        struct batch batch;
+        batch.sources = sources;
+        batch.memoize = memoize;
+        batch.count = workers;
+        batch.symbols = symbols;
+        batch.errors = errors;
+        pthread_mutex_init(&batch.output_lock, NULL);
+
+        batch.workers = (struct batch_worker *)calloc(workers,
+                                                      sizeof(*batch.workers));
+        pthread_t *threads = (pthread_t *)calloc(workers, sizeof(pthread_t));
+        int *started = (int *)calloc(workers, sizeof(int));
+        if (!batch.workers || !threads || !started) {
+                perror("Failed to allocate batch workers");
+                exit(EXIT_FAILURE);
+        }
+
+        for (unsigned i = 0; i < workers; i++) {
+                struct batch_worker *worker = &batch.workers[i];
+                worker->batch = &batch;
+                worker->id = i;
+                pthread_mutex_init(&worker->share.lock, NULL);
+                worker->share.next = sources->size * i / workers;
+                worker->share.end = sources->size * (i + 1) / workers;
+                output_open(&worker->symbols);
+                output_open(&worker->errors);
+        }
+
+        // the calling thread is worker 0. the share of a worker whose thread
+        // can't be started is stolen by the others
+        for (unsigned i = 1; i < workers; i++)
+                started[i] = pthread_create(&threads[i],
+                                            NULL,
+                                            batch_work,
+                                            &batch.workers[i]) == 0;
+        batch_work(&batch.workers[0]);
+        for (unsigned i = 1; i < workers; i++)
+                if (started[i])
+                        pthread_join(threads[i], NULL);
+
+        size_t failed = 0;
+        for (unsigned i = 0; i < workers; i++) {
+                struct batch_worker *worker = &batch.workers[i];
+                failed += worker->failed;
+                output_close(&worker->symbols, symbols);
+                output_close(&worker->errors, errors);
+                pthread_mutex_destroy(&worker->share.lock);
+        }
+
+        pthread_mutex_destroy(&batch.output_lock);
+        free(started);
+        free(threads);
+        free(batch.workers);
+        return failed;
+}
@@ -0,0 +1,57 @@
+#ifndef BATCH_H
+#define BATCH_H
+
+#include <stddef.h>
+#include <stdio.h>
+
+/**
+ * Paths of the sources of a batch run.
+ *
+ * Members:
+ * - paths: The paths, each allocated with malloc.
+ * - size: Number of paths.
+ * - capacity: Allocated length of paths.
+ */
+struct BatchSources {
+        char **paths;
+        size_t size;
+        size_t capacity;
+};
+
+/**
+ * Collects the sources named by path: every .ai file under it, recursively,
+ * if it is a directory, and otherwise each non-empty line of the list file
+ * it names, or of stdin if path is "-". Hidden directory entries are
+ * skipped and the rest are sorted.
+ *
+ * Returns 0 on success, or -1 with errno set if path or a directory under it
+ * can't be read. Requires freeing with batch_sources_destroy() either way.
+ */
+int batch_sources_collect(struct BatchSources *sources, const char *path);
+
+/**
+ * Frees the paths of sources.
+ */
+void batch_sources_destroy(struct BatchSources *sources);
+
+/**
+ * Lexes and parses every source on workers threads, which share the
+ * compiled-in transition table.
+ *
+ * Each worker starts with an even share of the sources and, once its share
+ * runs out, steals half of what another worker has left. Its symbol tables
+ * and errors are written to buffers of its own, and only a full buffer is
+ * copied to symbols or errors, so the threads rarely contend for them. The
+ * symbol table of a source is headed by "==> path <==" and never split up,
+ * but sources appear in the order they finish. Each error line starts with
+ * the path of its source. The ASTs are only built to find parse errors.
+ *
+ * Returns the number of sources that could not be read or failed to parse.
+ */
+size_t batch_run(const struct BatchSources *sources,
+                 unsigned workers,
+                 int memoize,
+                 FILE *symbols,
+                 FILE *errors);
+
+#endif
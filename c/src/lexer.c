@@ -1,156 +1,547 @@
+#include <errno.h>
+#include <pthread.h>
+#include <stdint.h>
 #include <stdlib.h>
-#include <stdio.h>
 #include <string.h>
 #include "lexer.h"
 
-static void lexer_clean(struct Lexer *l)
+int lexer_init(struct Lexer *lexer, const char *source, size_t length)
 {
-        struct TokenList *list = token_list_create();
-        for (size_t i = 0; i < l->tokens->size; i++) {
-                struct Token *tok = token_list_get(l->tokens, i);
-                if (tok->type != WHITESPACE && tok->type != COMMENT &&
-                    tok->type != MULTILINE_COMMENT) {
-                        token_list_insert(list, tok);
-                } else {
-                        free(tok->lexeme);
-                        free(tok);
+        // token offsets are 32 bits
+        if (length > UINT32_MAX) {
+                errno = EOVERFLOW;
+                return -1;
+        }
+
+        lexer->source_code = source;
+        lexer->source_length = length;
+        lexer->position = 0;
+        lexer->memoize = 0;
+        lexer->threads = 1;
+
+        return token_buffer_init(&lexer->tokens, source, length);
+}
+
+void lexer_destroy(struct Lexer *lexer)
+{
+        token_buffer_destroy(&lexer->tokens);
+}
+
+#ifdef TABLE_ENCODING_PACKED
+/*
+ * dfa_match() below, except that the entry of each transition says whether
+ * it accepts, so no per-state array is read per byte
+ */
+size_t dfa_match(const char *src, size_t len, int *accept_state)
+{
+        const unsigned char *p = (const unsigned char *)src;
+        const unsigned char *end = p + len;
+        int state = START_STATE_ID;
+        int run = 0;
+        size_t match = 0;
+
+        *accept_state = -1;
+        while (p < end) {
+                state_id_t entry = TRANSITION_TABLE[state][SYMBOL_TO_ID[*p++]];
+                int next_state = entry & (PACKED_ACCEPT - 1);
+                if (next_state == NO_STATE) {
+                        break;
+                }
+
+                // a skip stays in the state, so entry still tells if it
+                // accepts
+                if (next_state != state) {
+                        state = next_state;
+                        run = 0;
+                } else if (++run == ACCEL_MIN_RUN &&
+                           ACCEL[state].kind != ACCEL_NONE) {
+                        p = accel_skip(p, end, &ACCEL[state]);
+                }
+
+                if (entry & PACKED_ACCEPT) {
+                        match = (size_t)(p - (const unsigned char *)src);
+                        *accept_state = state;
                 }
         }
-        // TODO: free old list implementation
-        // token_list_free(l->tokens);
-        l->tokens = list;
+
+        return match;
+}
+#elif !defined(TABLE_ENCODING_DIRECT)
+/* steps through the generated table, the direct encoding generates this */
+size_t dfa_match(const char *src, size_t len, int *accept_state)
+{
+        const unsigned char *p = (const unsigned char *)src;
+        const unsigned char *end = p + len;
+        int state = START_STATE_ID;
+        int run = 0;
+        size_t match = 0;
+
+        *accept_state = -1;
+        while (p < end) {
+                int next_state = table_next(state, SYMBOL_TO_ID[*p++]);
+                if (next_state == NO_STATE) {
+                        break;
+                }
+
+                // jump over the rest of a run that has looped back to an
+                // accelerated state ACCEL_MIN_RUN times
+                if (next_state != state) {
+                        state = next_state;
+                        run = 0;
+                } else if (++run == ACCEL_MIN_RUN &&
+                           ACCEL[state].kind != ACCEL_NONE) {
+                        p = accel_skip(p, end, &ACCEL[state]);
+                }
+
+                if (ACCEPT_STATE_IDS[state]) {
+                        match = (size_t)(p - (const unsigned char *)src);
+                        *accept_state = state;
+                }
+        }
+
+        return match;
 }
+#endif
 
-void lexer_init(struct Lexer *lexer, char *source)
+#ifndef TABLE_ENCODING_DIRECT
+/*
+ * (state, position) pairs the DFA was in without accepting before it died,
+ * for Reps' memoized maximal munch. an open addressing set of
+ * pos * STATE_COUNT + state + 1, 0 marks an empty slot. if it runs out of
+ * memory it is emptied and stays empty, which leaves plain longest match
+ */
+struct munch_memo {
+        int failed;
+        uint64_t *keys;
+        size_t capacity; /* power of two */
+        size_t count;
+        size_t start; /* of the current match, pairs before it are stale */
+        size_t furthest; /* no pair after it has been recorded */
+
+        /* pairs since the last accept, a state looping over count bytes is
+         * one entry */
+        struct munch_run {
+                int state;
+                size_t pos;
+                size_t count;
+        } *trail;
+        size_t trail_size;
+        size_t trail_capacity;
+};
+
+static uint64_t memo_key(int state, size_t pos)
 {
-        lexer->source_code = source;
-        lexer->position = 0;
+        return (uint64_t)pos * STATE_COUNT + (uint64_t)state + 1;
+}
+
+static size_t memo_slot(const struct munch_memo *memo, uint64_t key)
+{
+        size_t slot = (size_t)((key * 0x9e3779b97f4a7c15ull) >> 32) &
+                      (memo->capacity - 1);
+        while (memo->keys[slot] != 0 && memo->keys[slot] != key)
+                slot = (slot + 1) & (memo->capacity - 1);
+        return slot;
+}
+
+static int memo_contains(const struct munch_memo *memo, int state, size_t pos)
+{
+        return memo->count > 0 &&
+               memo->keys[memo_slot(memo, memo_key(state, pos))] != 0;
+}
 
-        lexer->tokens = token_list_create();
-        if (!lexer->tokens) {
-                perror("Failed to create token list");
-                exit(EXIT_FAILURE);
+/* moves the pairs at or after memo->start into a table of capacity slots */
+static void memo_rehash(struct munch_memo *memo, size_t capacity)
+{
+        uint64_t *old_keys = memo->keys;
+        size_t old_capacity = memo->capacity;
+
+        memo->keys = (uint64_t *)calloc(capacity, sizeof(*memo->keys));
+        if (!memo->keys) {
+                free(old_keys);
+                memo->failed = 1;
+                memo->capacity = 0;
+                memo->count = 0;
+                return;
         }
+        memo->capacity = capacity;
+        memo->count = 0;
 
-        lexer->symbol_table_file = fopen("symbol_table.txt", "w");
-        if (!lexer->symbol_table_file) {
-                perror("Failed to open symbol table file");
-                exit(EXIT_FAILURE);
+        for (size_t i = 0; i < old_capacity; i++) {
+                uint64_t key = old_keys[i];
+                if (key != 0 && (key - 1) / STATE_COUNT >= memo->start) {
+                        memo->keys[memo_slot(memo, key)] = key;
+                        memo->count++;
+                }
         }
+        free(old_keys);
 }
 
-void lexer_lex(struct Lexer *lexer)
+static void memo_insert(struct munch_memo *memo, int state, size_t pos)
 {
-        int start_state = START_STATE_ID;
-        size_t source_len = strlen(lexer->source_code);
-        size_t current_pos = (size_t)lexer->position;
-        size_t cur_line = 1;
-        size_t cur_col = 1;
+        // at most half full. stale pairs are dropped first, and the table
+        // only grows if that leaves it more than a quarter full
+        if (2 * (memo->count + 1) > memo->capacity) {
+                memo_rehash(memo, memo->capacity ? memo->capacity : 1024);
+                if (!memo->failed && 4 * (memo->count + 1) > memo->capacity)
+                        memo_rehash(memo, 2 * memo->capacity);
+        }
+        if (memo->failed)
+                return;
 
-        while (current_pos < source_len) {
-                int current_state = start_state;
-                int last_accepting_state = -1;
-                int last_accepting_pos = -1;
-                size_t last_line = cur_line;
-                size_t last_col = cur_col;
-
-                size_t token_start_line = cur_line;
-                size_t token_start_col = cur_col;
-
-                size_t pos = current_pos;
-                size_t line = cur_line;
-                size_t col = cur_col;
-                while (pos < source_len) {
-                        unsigned char uc =
-                            (unsigned char)lexer->source_code[pos];
-                        int next_state = TRANSITION_TABLE[current_state][uc];
-
-                        if (next_state == -1) {
-                                break;
-                        }
+        uint64_t key = memo_key(state, pos);
+        size_t slot = memo_slot(memo, key);
+        if (memo->keys[slot] == 0) {
+                memo->keys[slot] = key;
+                memo->count++;
+        }
+}
 
-                        if (uc == '\n') {
-                                line++;
-                                col = 1;
-                        } else {
-                                col++;
-                        }
-                        current_state = next_state;
+static void memo_trail(struct munch_memo *memo, int state, size_t pos,
+                       size_t count)
+{
+        struct munch_run *last = memo->trail_size > 0 ?
+                                         &memo->trail[memo->trail_size - 1] :
+                                         NULL;
+        if (last && last->state == state && last->pos + last->count == pos) {
+                last->count += count;
+                return;
+        }
 
-                        if (ACCEPT_STATE_IDS[current_state]) {
-                                last_accepting_state = current_state;
-                                last_accepting_pos = (int)pos;
-                                last_line = line;
-                                last_col = col;
-                        }
+        if (memo->failed)
+                return;
+        if (memo->trail_size == memo->trail_capacity) {
+                size_t capacity = memo->trail_capacity ?
+                                          2 * memo->trail_capacity :
+                                          64;
+                struct munch_run *trail = (struct munch_run *)realloc(
+                    memo->trail, capacity * sizeof(*memo->trail));
+                if (!trail) {
+                        memo->failed = 1;
+                        memo->trail_size = 0;
+                        return;
+                }
+                memo->trail = trail;
+                memo->trail_capacity = capacity;
+        }
+        memo->trail[memo->trail_size++] =
+            (struct munch_run){ state, pos, count };
+}
 
-                        pos++;
-                }
-
-                if (last_accepting_state != -1) {
-                        size_t lexeme_length =
-                            (size_t)last_accepting_pos - current_pos + 1;
-                        char *lexeme = (char *)malloc(lexeme_length + 1);
-                        memcpy(lexeme,
-                               &lexer->source_code[current_pos],
-                               lexeme_length);
-                        lexeme[lexeme_length] = '\0';
-
-                        TokenType token_type =
-                            STATE_TOKEN_TYPE[last_accepting_state];
-
-                        struct Token *token =
-                            token_create(token_type,
-                                         lexeme,
-                                         (int)token_start_line,
-                                         (int)token_start_col);
-                        token_list_insert(lexer->tokens, token);
-
-                        free(lexeme);
-
-                        current_pos = (size_t)last_accepting_pos + 1;
-                        lexer->position = (int)current_pos;
-                        cur_line = last_line;
-                        cur_col = last_col;
-                } else {
-                        struct Token *token = token_create(
-                            UNKNOWN,
-                            (char[]){ lexer->source_code[current_pos], '\0' },
-                            (int)cur_line,
-                            (int)cur_col);
-                        token_list_insert(lexer->tokens, token);
-
-                        current_pos++;
-                        if (lexer->source_code[current_pos - 1] == '\n') {
-                                cur_line++;
-                                cur_col = 1;
-                        } else {
-                                cur_col++;
-                        }
-                        lexer->position = (int)current_pos;
+/*
+ * dfa_match() of src[start, len) that stops as soon as it reaches a pair
+ * memo has seen fail, since nothing can be accepted from there either. the
+ * pairs it passes after its last accept are added to memo. every pair fails
+ * at most once, so lexing stays linear in len
+ */
+static size_t dfa_match_memo(const char *src,
+                             size_t start,
+                             size_t len,
+                             struct munch_memo *memo,
+                             int *accept_state)
+{
+        const unsigned char *text = (const unsigned char *)src;
+        size_t pos = start;
+        int state = START_STATE_ID;
+        int run = 0;
+        size_t match = 0;
+
+        *accept_state = -1;
+        memo->start = start;
+        memo->trail_size = 0;
+        while (pos < len) {
+                if (pos <= memo->furthest && memo_contains(memo, state, pos)) {
+                        break;
+                }
+                memo_trail(memo, state, pos, 1);
+
+                int next_state = table_next(state, SYMBOL_TO_ID[text[pos]]);
+                if (next_state == NO_STATE) {
+                        break;
+                }
+                pos++;
+
+                // accelerated states only skip where no pair can have failed
+                if (next_state != state) {
+                        state = next_state;
+                        run = 0;
+                } else if (++run == ACCEL_MIN_RUN &&
+                           ACCEL[state].kind != ACCEL_NONE &&
+                           pos > memo->furthest) {
+                        size_t skipped = (size_t)(accel_skip(text + pos,
+                                                             text + len,
+                                                             &ACCEL[state]) -
+                                                  (text + pos));
+                        if (skipped > 0)
+                                memo_trail(memo, state, pos, skipped);
+                        pos += skipped;
+                }
+
+                if (ACCEPT_STATE_IDS[state]) {
+                        match = pos - start;
+                        *accept_state = state;
+                        memo->trail_size = 0;
                 }
         }
 
-        lexer_clean(lexer);
+        if (pos > memo->furthest)
+                memo->furthest = pos;
+        for (size_t i = 0; i < memo->trail_size; i++) {
+                const struct munch_run *r = &memo->trail[i];
+                for (size_t j = 0; j < r->count; j++)
+                        memo_insert(memo, r->state, r->pos + j);
+        }
+
+        return match;
+}
+#endif
+
+/*
+ * type of the token dfa_match() found at lexeme, or UNKNOWN with *length set
+ * to 1 if it found none
+ */
+static TokenType match_type(const char *lexeme,
+                            size_t *length,
+                            int accept_state)
+{
+        if (*length == 0) {
+                *length = 1;
+                return UNKNOWN;
+        }
+
+        TokenType type = STATE_TOKEN_TYPE[accept_state];
+#ifdef TABLE_KEYWORDS
+        type = keyword_type(type, lexeme, *length);
+#else
+        (void)lexeme;
+#endif
+        return type;
+}
+
+/* whitespace and comments are dropped here, the parser never sees them */
+static int is_skipped(TokenType type)
+{
+        return type == WHITESPACE || type == COMMENT ||
+               type == MULTILINE_COMMENT;
+}
+
+/*
+ * chunk of a parallel lex. its worker lexes from begin as if a token started
+ * there into tokens, and stops at end, where the first token at or past
+ * bound starts
+ */
+struct lex_chunk {
+        const struct Lexer *lexer;
+        size_t begin;
+        size_t bound;
+        size_t end;
+        struct TokenBuffer tokens;
+        int failed;
+};
+
+static void *lex_chunk_work(void *arg)
+{
+        struct lex_chunk *chunk = (struct lex_chunk *)arg;
+        const char *source = chunk->lexer->source_code;
+        size_t source_len = chunk->lexer->source_length;
+
+        size_t pos = chunk->begin;
+        while (pos < chunk->bound) {
+                int accept_state;
+                size_t length =
+                    dfa_match(&source[pos], source_len - pos, &accept_state);
+                TokenType type = match_type(&source[pos], &length, accept_state);
+                if (!is_skipped(type) &&
+                    token_buffer_push(&chunk->tokens,
+                                      type,
+                                      (uint32_t)pos,
+                                      (uint32_t)length) != 0) {
+                        chunk->failed = 1;
+                        break;
+                }
+                pos += length;
+        }
+        chunk->end = pos;
+        return NULL;
 }
 
-void lexer_print_toks(struct Lexer *lx)
+/*
+ * lexer_lex() of source[position, length) on workers threads, the calling
+ * thread being one of them. a chunk whose thread can't be started is lexed
+ * on the calling thread after its own
+ */
+static int lexer_lex_parallel(struct Lexer *lexer, unsigned workers)
 {
-        for (size_t i = 0; i < lx->tokens->size; i++) {
-                struct Token *tok = token_list_get(lx->tokens, i);
+        const char *source = lexer->source_code;
+        size_t source_len = lexer->source_length;
+        size_t begin = lexer->position;
 
-                if (!tok) {
+        struct lex_chunk *chunks =
+            (struct lex_chunk *)calloc(workers, sizeof(*chunks));
+        pthread_t *threads = (pthread_t *)calloc(workers, sizeof(pthread_t));
+        int *started = (int *)calloc(workers, sizeof(int));
+        int result = chunks && threads && started ? 0 : -1;
+
+        // chunk k ends where chunk k + 1 begins, after a newline where there
+        // is one, since most tokens end at a line end
+        unsigned initialized = 0;
+        for (unsigned k = 0; result == 0 && k < workers; k++) {
+                struct lex_chunk *chunk = &chunks[k];
+                chunk->lexer = lexer;
+                chunk->begin = k > 0 ? chunks[k - 1].bound : begin;
+                chunk->bound = source_len;
+                if (k + 1 < workers) {
+                        size_t split =
+                            begin + (source_len - begin) / workers * (k + 1);
+                        const char *newline = (const char *)memchr(
+                            &source[split], '\n', source_len - split);
+                        if (newline)
+                                chunk->bound = (size_t)(newline - source) + 1;
+                        if (chunk->bound < chunk->begin)
+                                chunk->bound = chunk->begin;
+                }
+                if (token_buffer_init(&chunk->tokens,
+                                      source,
+                                      chunk->bound - chunk->begin) != 0)
+                        result = -1;
+                else
+                        initialized++;
+        }
+
+        if (result == 0) {
+                for (unsigned k = 1; k < workers; k++)
+                        started[k] = pthread_create(&threads[k],
+                                                    NULL,
+                                                    lex_chunk_work,
+                                                    &chunks[k]) == 0;
+                lex_chunk_work(&chunks[0]);
+                for (unsigned k = 1; k < workers; k++) {
+                        if (started[k])
+                                pthread_join(threads[k], NULL);
+                        else
+                                lex_chunk_work(&chunks[k]);
+                }
+                for (unsigned k = 0; k < workers; k++)
+                        if (chunks[k].failed)
+                                result = -1;
+        }
+
+        // a match depends only on where it starts, so once the real tokens
+        // start one where a chunk did, the rest of that chunk is right. up
+        // to there, as when a seam falls inside a string or comment, it is
+        // relexed. the chunks hold no whitespace or comments, so tokens are
+        // only compared at the starts of the others
+        size_t pos = begin;
+        for (unsigned k = 0; result == 0 && k < workers; k++) {
+                const struct lex_chunk *chunk = &chunks[k];
+                const struct TokenBuffer *tokens = &chunk->tokens;
+                size_t next = 0;
+                while (pos < chunk->bound) {
+                        while (next < tokens->size &&
+                               tokens->offsets[next] < pos)
+                                next++;
+                        if (next < tokens->size &&
+                            tokens->offsets[next] == pos)
+                                break;
+
+                        int accept_state;
+                        size_t length = dfa_match(&source[pos],
+                                                  source_len - pos,
+                                                  &accept_state);
+                        TokenType type =
+                            match_type(&source[pos], &length, accept_state);
+                        if (!is_skipped(type) &&
+                            token_buffer_push(&lexer->tokens,
+                                              type,
+                                              (uint32_t)pos,
+                                              (uint32_t)length) != 0) {
+                                result = -1;
+                                break;
+                        }
+                        pos += length;
+                }
+                if (result != 0 || pos >= chunk->bound)
                         continue;
+
+                for (; next < tokens->size; next++) {
+                        if (token_buffer_push(&lexer->tokens,
+                                              tokens->kinds[next],
+                                              tokens->offsets[next],
+                                              tokens->lengths[next]) != 0) {
+                                pos = tokens->offsets[next];
+                                result = -1;
+                                break;
+                        }
                 }
+                if (result == 0)
+                        pos = chunk->end;
+        }
+        lexer->position = pos;
+
+        for (unsigned k = 0; k < initialized; k++)
+                token_buffer_destroy(&chunks[k].tokens);
+        free(started);
+        free(threads);
+        free(chunks);
+        return result;
+}
+
+int lexer_lex(struct Lexer *lexer)
+{
+        // a memoized lex keeps its failed pairs in one table
+        size_t workers = lexer->threads;
+        if ((lexer->source_length - lexer->position) / LEXER_MIN_CHUNK <
+            workers)
+                workers = (lexer->source_length - lexer->position) /
+                          LEXER_MIN_CHUNK;
+        if (!lexer->memoize && workers > 1)
+                return lexer_lex_parallel(lexer, (unsigned)workers);
 
-                if (tok->type != WHITESPACE && tok->type != COMMENT &&
-                    tok->type != MULTILINE_COMMENT) {
-                        fprintf(lx->symbol_table_file,
-                                "%-30s %-30s Line: %-5d Col: %-5d\n",
-                                tok_type_to_str(tok->type),
-                                tok->lexeme,
-                                tok->line,
-                                tok->col);
+        size_t source_len = lexer->source_length;
+        size_t current_pos = (size_t)lexer->position;
+        int result = 0;
+#ifndef TABLE_ENCODING_DIRECT
+        struct munch_memo memo = { 0 };
+#endif
+
+        while (current_pos < source_len) {
+                int accept_state;
+                size_t lexeme_length;
+#ifndef TABLE_ENCODING_DIRECT
+                if (lexer->memoize)
+                        lexeme_length = dfa_match_memo(lexer->source_code,
+                                                       current_pos,
+                                                       source_len,
+                                                       &memo,
+                                                       &accept_state);
+                else
+#endif
+                        lexeme_length =
+                            dfa_match(&lexer->source_code[current_pos],
+                                      source_len - current_pos,
+                                      &accept_state);
+
+                TokenType token_type =
+                    match_type(&lexer->source_code[current_pos],
+                               &lexeme_length,
+                               accept_state);
+                if (!is_skipped(token_type) &&
+                    token_buffer_push(&lexer->tokens,
+                                      token_type,
+                                      (uint32_t)current_pos,
+                                      (uint32_t)lexeme_length) != 0) {
+                        result = -1;
+                        break;
                 }
+
+                // lines and columns are found from the offset when they are
+                // asked for, see token_buffer_position()
+                current_pos += lexeme_length;
+                lexer->position = current_pos;
         }
+
+#ifndef TABLE_ENCODING_DIRECT
+        free(memo.keys);
+        free(memo.trail);
+#endif
+        return result;
 }
\ No newline at end of file
@@ -1,43 +1,78 @@
 #ifndef LEXER_H
 #define LEXER_H
 
+#include <stddef.h>
 #include "token.h"
 #include "transition_table.h"
 
+/* a source is only split across threads in chunks of at least this size */
+#define LEXER_MIN_CHUNK (64 * 1024)
+
 /**
  * Lexer structure representing a lexical analyzer.
  *
+ * A Lexer only touches its own members and the caller's buffer. It does no
+ * I/O and keeps no global state, so any number of them can lex at once, on
+ * any threads. See lexer_report.h for printing the tokens.
+ *
  * Members:
- * - tokens: Pointer to a TokenList containing the tokens generated by the
- * lexer.
- * - source_code: Pointer to the source code string to be lexed.
+ * - tokens: The tokens generated by the lexer. They refer to the source code
+ * by offset.
+ * - source_code: Pointer to the source code to be lexed. It is not copied
+ * and must outlive the tokens.
+ * - source_length: Length of the source code. It need not be NUL-terminated.
  * - position: Current position in the source code.
- * - symbol_table_file: File pointer for writing the symbol table.
- *
- * symbol_table_file is used to output the symbol table to a file named
- * "symbol_table.txt".
+ * - memoize: Nonzero to lex with Reps' memoized maximal munch, which keeps
+ * lexing linear in the source length on inputs that make plain longest match
+ * rescan the same bytes. Set by the caller after lexer_init(), ignored with
+ * the direct table encoding.
+ * - threads: Number of threads lexer_lex() may split the source across, at
+ * least LEXER_MIN_CHUNK bytes each. Each thread lexes its chunk as if a token
+ * started there, and the seams are relexed until they agree with the next
+ * chunk, so the tokens are the same as with one thread. Set by the caller
+ * after lexer_init(), a memoized lex stays on one thread.
  */
 struct Lexer {
-        struct TokenList *tokens;
-        char *source_code;
+        struct TokenBuffer tokens;
+        const char *source_code;
+        size_t source_length;
         size_t position;
-
-        FILE *symbol_table_file;
+        int memoize;
+        unsigned threads;
 };
 
 /**
- * Initializes a Lexer structure with the given source code.
+ * Initializes a Lexer over source[0, length). Memoization is off and it lexes
+ * on one thread.
+ *
+ * Returns 0 on success, or -1 if the token buffer can't be allocated or,
+ * with errno set to EOVERFLOW, if length doesn't fit the 32-bit token
+ * offsets. Requires freeing with lexer_destroy() on success.
+ */
+int lexer_init(struct Lexer *lexer, const char *source, size_t length);
+
+/**
+ * Performs lexical analysis on the source code and populates the token
+ * buffer in a single pass, leaving out whitespace and comments.
+ *
+ * Returns 0 on success, or -1 if the token buffer can't grow. The tokens up
+ * to there are kept.
  */
-void lexer_init(struct Lexer *lexer, char *source);
+int lexer_lex(struct Lexer *lexer);
 
 /**
- * Performs lexical analysis on the source code and populates the token list.
+ * Frees the token buffer of a lexer, the source code is left alone.
  */
-void lexer_lex(struct Lexer *lexer);
+void lexer_destroy(struct Lexer *lexer);
 
 /**
- * Prints the tokens in the lexer's token list to the symbol table file.
+ * Returns the length of the longest prefix of src[0, len) accepted by the
+ * DFA and stores its accepting state in *accept_state. Returns 0 and stores
+ * -1 if no prefix is accepted.
+ *
+ * Defined in lexer.c for the table encodings of transition_table.c and
+ * generated into transition_table.c for the direct encoding.
  */
-void lexer_print_toks(struct Lexer *lx);
+size_t dfa_match(const char *src, size_t len, int *accept_state);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,36 @@
+#include "lexer_report.h"
+
+/* prints token i of tokens as a line of the symbol table */
+static void print_tok(FILE *file,
+                      const struct TokenBuffer *tokens,
+                      size_t i,
+                      int line,
+                      int col)
+{
+        fprintf(file,
+                "%-30s %-30.*s Line: %-5d Col: %-5d\n",
+                tok_type_to_str(tokens->kinds[i]),
+                (int)tokens->lengths[i],
+                tokens->source + tokens->offsets[i],
+                line,
+                col);
+}
+
+void lexer_print_toks(FILE *file, struct TokenBuffer *tokens)
+{
+        // the buffer holds no whitespace or comments
+        for (size_t i = 0; i < tokens->size; i++) {
+                int line, col;
+                token_buffer_position(tokens, i, &line, &col);
+                print_tok(file, tokens, i, line, col);
+        }
+}
+
+void lexer_print_stream_toks(FILE *file, struct LexerStream *stream)
+{
+        for (size_t i = 0; i < stream->tokens.size; i++) {
+                int line, col;
+                lexer_stream_position(stream, i, &line, &col);
+                print_tok(file, &stream->tokens, i, line, col);
+        }
+}
@@ -0,0 +1,25 @@
+#ifndef LEXER_REPORT_H
+#define LEXER_REPORT_H
+
+#include <stdio.h>
+#include "lexer_stream.h"
+#include "token.h"
+
+/**
+ * Optional reporters for the tokens of a Lexer or LexerStream. The lexers
+ * themselves do no I/O, so these are all that writes the symbol table.
+ */
+
+/**
+ * Prints every token of tokens to file, one symbol table line each. Builds
+ * the line index of tokens if it has none yet.
+ */
+void lexer_print_toks(FILE *file, struct TokenBuffer *tokens);
+
+/**
+ * Prints the tokens of the last lexer_stream_lex() of stream to file, with
+ * their lines and columns in the whole input.
+ */
+void lexer_print_stream_toks(FILE *file, struct LexerStream *stream);
+
+#endif
@@ -0,0 +1,306 @@
+#include <errno.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "lexer_stream.h"
+
+int lexer_stream_position(struct LexerStream *stream,
+                          size_t i,
+                          int *line,
+                          int *col)
+{
+        if (token_buffer_position(&stream->tokens, i, line, col) != 0)
+                return -1;
+
+        // the buffer counts from tokens.source, which is at line, col
+        if (*line == 1)
+                *col += (int)stream->col - 1;
+        *line += (int)stream->line - 1;
+        return 0;
+}
+
+#ifndef TABLE_ENCODING_DIRECT
+
+/* bytes asked for per read */
+#define LEXER_STREAM_CHUNK (64 * 1024)
+
+static long read_file(void *context, char *buf, size_t size)
+{
+        FILE *file = (FILE *)context;
+        size_t n = fread(buf, 1, size, file);
+        if (n == 0 && ferror(file))
+                return -1;
+        return (long)n;
+}
+
+static long read_fd(void *context, char *buf, size_t size)
+{
+        int fd = (int)(intptr_t)context;
+        ssize_t n;
+        do {
+                n = read(fd, buf, size);
+        } while (n < 0 && errno == EINTR);
+        return (long)n;
+}
+
+int lexer_stream_init(struct LexerStream *stream,
+                      lexer_read_fn read,
+                      void *context)
+{
+        stream->read = read;
+        stream->context = context;
+        stream->chunk = LEXER_STREAM_CHUNK;
+        stream->capacity = 2 * LEXER_STREAM_CHUNK;
+        stream->buffer = (char *)malloc(stream->capacity);
+        if (!stream->buffer)
+                return -1;
+        stream->start = 0;
+        stream->end = 0;
+        stream->eof = 0;
+        stream->error = 0;
+        stream->line = 1;
+        stream->col = 1;
+
+        // no tokens until the first lexer_stream_lex()
+        if (token_buffer_init(&stream->tokens, stream->buffer, 0) != 0) {
+                free(stream->buffer);
+                stream->buffer = NULL;
+                return -1;
+        }
+        return 0;
+}
+
+int lexer_stream_init_file(struct LexerStream *stream, FILE *file)
+{
+        return lexer_stream_init(stream, read_file, file);
+}
+
+int lexer_stream_init_fd(struct LexerStream *stream, int fd)
+{
+        return lexer_stream_init(stream, read_fd, (void *)(intptr_t)fd);
+}
+
+void lexer_stream_destroy(struct LexerStream *stream)
+{
+        token_buffer_destroy(&stream->tokens);
+        free(stream->buffer);
+        stream->buffer = NULL;
+}
+
+/*
+ * reads more input after buffer[end]. the unlexed bytes are moved to the
+ * front first if a chunk no longer fits after them, and the buffer only
+ * grows if they fill it. *pos is a position in the buffer that moves with
+ * them. returns 1 if it read more, 0 once there is no more input, or -1 if
+ * the buffer can't grow, which leaves it as it was
+ */
+static int stream_fill(struct LexerStream *stream, size_t *pos)
+{
+        if (stream->eof || stream->error)
+                return 0;
+
+        // one byte is kept spare after end to NUL terminate a lexeme
+        if (stream->end + stream->chunk + 1 > stream->capacity &&
+            stream->start > 0) {
+                memmove(stream->buffer,
+                        stream->buffer + stream->start,
+                        stream->end - stream->start);
+                stream->end -= stream->start;
+                *pos -= stream->start;
+                stream->start = 0;
+        }
+        if (stream->end + stream->chunk + 1 > stream->capacity) {
+                char *buffer =
+                    (char *)realloc(stream->buffer, 2 * stream->capacity);
+                if (!buffer)
+                        return -1;
+                stream->buffer = buffer;
+                stream->capacity *= 2;
+        }
+
+        long n = stream->read(stream->context,
+                              stream->buffer + stream->end,
+                              stream->capacity - stream->end - 1);
+        if (n < 0) {
+                stream->error = 1;
+                return 0;
+        }
+        if (n == 0) {
+                stream->eof = 1;
+                return 0;
+        }
+        stream->end += (size_t)n;
+        return 1;
+}
+
+/*
+ * dfa_match() of the unlexed input. when the DFA is still alive at the end of
+ * the buffer it reads on if fill is set, and otherwise returns 0 since the
+ * match isn't known yet. as with dfa_match(), the bytes read past the last
+ * accept are matched again as the start of the next token. returns 1 with
+ * the match in *length, or -1 if the buffer can't grow
+ */
+static int stream_match(struct LexerStream *stream,
+                        int fill,
+                        size_t *length,
+                        int *accept_state)
+{
+        size_t pos = stream->start;
+        int state = START_STATE_ID;
+        size_t run = 0;
+        size_t match = 0;
+
+        *accept_state = -1;
+        for (;;) {
+                if (pos == stream->end) {
+                        if (!fill && !stream->eof && !stream->error)
+                                return 0;
+                        int filled = stream_fill(stream, &pos);
+                        if (filled < 0)
+                                return -1;
+                        if (filled == 0)
+                                break;
+                }
+
+                const unsigned char *text =
+                    (const unsigned char *)stream->buffer;
+                int next_state = table_next(state, SYMBOL_TO_ID[text[pos]]);
+                if (next_state == NO_STATE)
+                        break;
+                pos++;
+
+                // a skip that stops at the end of the buffer goes on after
+                // the next read, other skips stop where the state changes
+                if (next_state != state) {
+                        state = next_state;
+                        run = 0;
+                } else if (++run >= ACCEL_MIN_RUN &&
+                           ACCEL[state].kind != ACCEL_NONE) {
+                        pos = (size_t)(accel_skip(text + pos,
+                                                  text + stream->end,
+                                                  &ACCEL[state]) -
+                                       text);
+                }
+
+                if (ACCEPT_STATE_IDS[state]) {
+                        match = pos - stream->start;
+                        *accept_state = state;
+                }
+        }
+
+        *length = match;
+        return 1;
+}
+
+/* moves line and col past text[0, length) */
+static void stream_count(struct LexerStream *stream,
+                         const char *text,
+                         size_t length)
+{
+        const char *line_start = text;
+        const char *newline;
+        while ((newline = memchr(line_start,
+                                 '\n',
+                                 text + length - line_start)) != NULL) {
+                stream->line++;
+                stream->col = 1;
+                line_start = newline + 1;
+        }
+        stream->col += (size_t)(text + length - line_start);
+}
+
+int lexer_stream_lex(struct LexerStream *stream)
+{
+        // the last tokens are done with, line and col move past them
+        if (stream->tokens.source_length > 0)
+                stream_count(stream,
+                             stream->tokens.source,
+                             stream->tokens.source_length);
+        token_buffer_destroy(&stream->tokens);
+        stream->tokens.source_length = 0;
+
+        // the buffer is only read into until the first token is found, so
+        // it doesn't move under the offsets of the tokens after it. a token
+        // that runs past the buffer ends the call and is lexed again by the
+        // next one
+        int started = 0;
+        size_t first = stream->start;
+        int result = 0;
+        for (;;) {
+                if (stream->start == stream->end) {
+                        if (started)
+                                break;
+                        size_t pos = stream->start;
+                        int filled = stream_fill(stream, &pos);
+                        if (filled < 0)
+                                result = -1;
+                        if (filled <= 0)
+                                break;
+                }
+
+                int accept_state;
+                size_t length;
+                int matched =
+                    stream_match(stream, !started, &length, &accept_state);
+                if (matched < 0)
+                        result = -1;
+                if (matched <= 0)
+                        break;
+                const char *lexeme = stream->buffer + stream->start;
+                TokenType type = UNKNOWN;
+                if (length > 0) {
+                        type = STATE_TOKEN_TYPE[accept_state];
+#ifdef TABLE_KEYWORDS
+                        type = keyword_type(type, lexeme, length);
+#endif
+                } else {
+                        length = 1;
+                }
+
+                if (type == WHITESPACE || type == COMMENT ||
+                    type == MULTILINE_COMMENT) {
+                        if (!started)
+                                stream_count(stream, lexeme, length);
+                        stream->start += length;
+                        continue;
+                }
+
+                if (!started) {
+                        if (token_buffer_init(&stream->tokens,
+                                              lexeme,
+                                              stream->end - stream->start) !=
+                            0) {
+                                result = -1;
+                                break;
+                        }
+                        started = 1;
+                        first = stream->start;
+                }
+
+                // token offsets are 32 bits
+                if (stream->start - first + length > UINT32_MAX) {
+                        if (stream->tokens.size == 0) {
+                                errno = EOVERFLOW;
+                                result = -1;
+                        }
+                        break;
+                }
+                if (token_buffer_push(&stream->tokens,
+                                      type,
+                                      (uint32_t)(stream->start - first),
+                                      (uint32_t)length) != 0) {
+                        result = -1;
+                        break;
+                }
+                stream->start += length;
+        }
+
+        if (started)
+                stream->tokens.source_length = stream->start - first;
+        if (result == 0 && stream->tokens.size > 0)
+                result = 1;
+        return result;
+}
+
+#endif
@@ -0,0 +1,108 @@
+#ifndef LEXER_STREAM_H
+#define LEXER_STREAM_H
+
+#include <stdio.h>
+#include "token.h"
+#include "transition_table.h"
+
+/**
+ * Reads up to size bytes of input into buf.
+ *
+ * Returns the number of bytes read, 0 at the end of the input, or a negative
+ * value on error.
+ */
+typedef long (*lexer_read_fn)(void *context, char *buf, size_t size);
+
+/**
+ * Pull-based lexer over input that arrives in chunks, for sources too large
+ * to hold in memory. Tokens may span any number of chunks.
+ *
+ * Only the bytes of the tokens being lexed are buffered, together with the
+ * bytes the DFA reads past them before it dies, so memory stays bounded by
+ * the chunk size and the longest token rather than the input size. Each
+ * lexer_stream_lex() lexes the buffered input into tokens, which refer to the
+ * buffer like the tokens of a Lexer refer to its source. Not available with
+ * the direct table encoding, which has no table to resume a match from when
+ * a chunk ends.
+ *
+ * Members:
+ * - tokens: The tokens of the last lexer_stream_lex(), tokens.source is where
+ * the first of them starts in buffer.
+ * - read, context: Where the input comes from, see lexer_read_fn.
+ * - buffer: Buffered input, buffer[start, end) has not been lexed yet.
+ * - chunk: Bytes asked for per read.
+ * - eof: Nonzero once read has reported the end of the input.
+ * - error: Nonzero once read has failed. The input then ends there.
+ * - line, col: Position of tokens.source[0] in the input.
+ */
+struct LexerStream {
+        struct TokenBuffer tokens;
+
+        lexer_read_fn read;
+        void *context;
+
+        char *buffer;
+        size_t capacity;
+        size_t start;
+        size_t end;
+        size_t chunk;
+        int eof;
+        int error;
+
+        size_t line;
+        size_t col;
+};
+
+/**
+ * Initializes a stream that pulls its input from read.
+ *
+ * Returns 0 on success, or -1 if the buffer or tokens can't be allocated,
+ * in which case nothing is left to free. Requires freeing with
+ * lexer_stream_destroy() on success.
+ */
+int lexer_stream_init(struct LexerStream *stream,
+                      lexer_read_fn read,
+                      void *context);
+
+/**
+ * Initializes a stream over an open file, which the stream does not close.
+ * Returns like lexer_stream_init().
+ */
+int lexer_stream_init_file(struct LexerStream *stream, FILE *file);
+
+/**
+ * Initializes a stream over an open file descriptor, which the stream does
+ * not close. Returns like lexer_stream_init().
+ */
+int lexer_stream_init_fd(struct LexerStream *stream, int fd);
+
+/**
+ * Frees the buffer and tokens of a stream.
+ */
+void lexer_stream_destroy(struct LexerStream *stream);
+
+/**
+ * Replaces stream->tokens with the tokens of the next stretch of input,
+ * leaving out whitespace and comments like lexer_lex(). Reads once the
+ * buffered input runs out, the tokens stay valid until the next call.
+ *
+ * Returns 1 if there are tokens, 0 at the end of the input, or -1 if the
+ * buffer can't grow or the token buffer can't be allocated or, with errno set to EOVERFLOW, if a
+ * token doesn't fit the 32-bit token offsets. Check stream->error to tell a
+ * read error from the end.
+ */
+int lexer_stream_lex(struct LexerStream *stream);
+
+/**
+ * Stores the line and column in the input of the first byte of token i of
+ * stream->tokens, counting from 1, in *line and *col.
+ *
+ * Returns 0 on success, or -1 and stores -1 in both if the line index can't
+ * be allocated.
+ */
+int lexer_stream_position(struct LexerStream *stream,
+                          size_t i,
+                          int *line,
+                          int *col);
+
+#endif
@@ -0,0 +1,139 @@
+#include <string.h>
+#include "line_index.h"
+
+#ifdef __SSE2__
+#include <immintrin.h>
+#ifdef __GNUC__
+#define LINE_INDEX_HAVE_AVX2
+#endif
+#endif
+
+/*
+ * the scans below return the number of newlines in text[0, length) and, if
+ * starts is not NULL, store the offset after each one in it
+ */
+
+static size_t scan_scalar(const char *text,
+                          size_t length,
+                          size_t base,
+                          uint32_t *starts)
+{
+        size_t count = 0;
+        const char *p = text;
+        const char *end = text + length;
+        const char *newline;
+        while ((newline = memchr(p, '\n', (size_t)(end - p))) != NULL) {
+                if (starts)
+                        starts[count] = (uint32_t)(base + (newline - text) + 1);
+                count++;
+                p = newline + 1;
+        }
+        return count;
+}
+
+#ifdef __SSE2__
+static size_t scan_sse2(const char *text, size_t length, uint32_t *starts)
+{
+        const __m128i newline = _mm_set1_epi8('\n');
+        size_t count = 0;
+        size_t i = 0;
+        for (; length - i >= 16; i += 16) {
+                __m128i chunk = _mm_loadu_si128((const __m128i *)(text + i));
+                unsigned mask = (unsigned)_mm_movemask_epi8(
+                    _mm_cmpeq_epi8(chunk, newline));
+                if (!starts) {
+                        count += (size_t)__builtin_popcount(mask);
+                        continue;
+                }
+                for (; mask; mask &= mask - 1)
+                        starts[count++] =
+                            (uint32_t)(i + __builtin_ctz(mask) + 1);
+        }
+
+        return count + scan_scalar(text + i,
+                                   length - i,
+                                   i,
+                                   starts ? starts + count : NULL);
+}
+#endif
+
+#ifdef LINE_INDEX_HAVE_AVX2
+/* scan_sse2() 32 bytes at a time, only called when the cpu has avx2 */
+__attribute__((target("avx2"))) static size_t
+scan_avx2(const char *text, size_t length, uint32_t *starts)
+{
+        const __m256i newline = _mm256_set1_epi8('\n');
+        size_t count = 0;
+        size_t i = 0;
+        for (; length - i >= 32; i += 32) {
+                __m256i chunk =
+                    _mm256_loadu_si256((const __m256i *)(text + i));
+                unsigned mask = (unsigned)_mm256_movemask_epi8(
+                    _mm256_cmpeq_epi8(chunk, newline));
+                if (!starts) {
+                        count += (size_t)__builtin_popcount(mask);
+                        continue;
+                }
+                for (; mask; mask &= mask - 1)
+                        starts[count++] =
+                            (uint32_t)(i + __builtin_ctz(mask) + 1);
+        }
+
+        return count + scan_scalar(text + i,
+                                   length - i,
+                                   i,
+                                   starts ? starts + count : NULL);
+}
+#endif
+
+static size_t scan(const char *text, size_t length, uint32_t *starts)
+{
+#ifdef LINE_INDEX_HAVE_AVX2
+        if (__builtin_cpu_supports("avx2"))
+                return scan_avx2(text, length, starts);
+#endif
+#ifdef __SSE2__
+        return scan_sse2(text, length, starts);
+#else
+        return scan_scalar(text, length, 0, starts);
+#endif
+}
+
+int line_index_build(struct LineIndex *index,
+                     struct Arena *arena,
+                     const char *text,
+                     size_t length)
+{
+        // counted first, so the starts take one exact allocation
+        size_t count = scan(text, length, NULL) + 1;
+        uint32_t *starts =
+            (uint32_t *)arena_alloc(arena, count * sizeof(*starts));
+        if (!starts)
+                return -1;
+
+        starts[0] = 0;
+        scan(text, length, starts + 1);
+        index->starts = starts;
+        index->count = count;
+        return 0;
+}
+
+void line_index_position(const struct LineIndex *index,
+                         size_t offset,
+                         size_t *line,
+                         size_t *col)
+{
+        // the last line starting at or before offset
+        size_t lo = 0;
+        size_t hi = index->count;
+        while (hi - lo > 1) {
+                size_t mid = lo + (hi - lo) / 2;
+                if (index->starts[mid] <= offset)
+                        lo = mid;
+                else
+                        hi = mid;
+        }
+
+        *line = lo + 1;
+        *col = offset - index->starts[lo] + 1;
+}
@@ -0,0 +1,42 @@
+#ifndef LINE_INDEX_H
+#define LINE_INDEX_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "arena.h"
+
+/**
+ * Offsets of the line starts of a text, so a line and column can be found
+ * from an offset with a binary search instead of being counted while
+ * lexing.
+ *
+ * Members:
+ * - starts: Offset of the first byte of each line, starts[0] is 0.
+ * - count: Number of lines, one more than the number of newlines.
+ */
+struct LineIndex {
+        uint32_t *starts;
+        size_t count;
+};
+
+/**
+ * Finds every newline of text[0, length), 32 or 16 bytes at a time with
+ * AVX2 or SSE2, picked at runtime, and stores the line starts in arena.
+ *
+ * Returns 0 on success, or -1 if the starts can't be allocated.
+ */
+int line_index_build(struct LineIndex *index,
+                     struct Arena *arena,
+                     const char *text,
+                     size_t length);
+
+/**
+ * Stores the line and column of offset, both counting from 1, in *line and
+ * *col. A column counts bytes, and a newline belongs to the line it ends.
+ */
+void line_index_position(const struct LineIndex *index,
+                         size_t offset,
+                         size_t *line,
+                         size_t *col);
+
+#endif
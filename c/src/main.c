@@ -1,9 +1,14 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <unistd.h>
 #include "ast_print.h"
+#include "batch.h"
 #include "lexer.h"
+#include "lexer_report.h"
+#include "lexer_stream.h"
 #include "parser.h"
+#include "source_buffer.h"
 
 const char *get_file_extension(const char *filename)
 {
@@ -19,57 +24,187 @@ int has_extenstion(const char *filename, const char *ext)
         return strcmp(file_ext, ext) == 0;
 }
 
-char *read_file(const char *filename)
+/*
+ * loads filename, or stdin if it is "-", into source. returns 0 on success
+ */
+int read_file(const char *filename, struct SourceBuffer *source)
 {
-        FILE *source_file = fopen(filename, "r");
-        if (!source_file) {
+        if (strcmp(filename, "-") != 0 && !has_extenstion(filename, "ai")) {
+                fprintf(stderr,
+                        "Error: Source file must have a .ai extension\n");
+                return -1;
+        }
+
+        if (source_buffer_load(source, filename) != 0) {
                 perror("Failed to open source file");
-                return NULL;
+                return -1;
         }
 
-        if (!has_extenstion(filename, "ai")) {
+        return 0;
+}
+
+/*
+ * writes the symbol table of filename as it is read, chunk by chunk, for
+ * sources too large to hold in memory. nothing is parsed
+ */
+int stream_symbol_table(const char *filename)
+{
+#ifdef TABLE_ENCODING_DIRECT
+        (void)filename;
+        fprintf(stderr, "Error: --stream needs a table encoding\n");
+        return 0;
+#else
+        int standard_input = strcmp(filename, "-") == 0;
+        if (!standard_input && !has_extenstion(filename, "ai")) {
                 fprintf(stderr,
                         "Error: Source file must have a .ai extension\n");
+                return 0;
+        }
+
+        FILE *source_file = standard_input ? stdin : fopen(filename, "r");
+        if (!source_file) {
+                perror("Failed to open source file");
+                return 0;
+        }
+
+        FILE *symbol_table_file = fopen("symbol_table.txt", "w");
+        if (!symbol_table_file) {
+                perror("Failed to open symbol table file");
                 fclose(source_file);
-                return NULL;
+                return 0;
         }
 
-        fseek(source_file, 0, SEEK_END);
-        long file_size = ftell(source_file);
-        fseek(source_file, 0, SEEK_SET);
+        struct LexerStream stream;
+        if (lexer_stream_init_file(&stream, source_file) != 0) {
+                perror("Failed to allocate stream");
+                fclose(symbol_table_file);
+                if (!standard_input)
+                        fclose(source_file);
+                return 0;
+        }
+        int lexed;
+        while ((lexed = lexer_stream_lex(&stream)) > 0)
+                lexer_print_stream_toks(symbol_table_file, &stream);
 
-        char *src_code = (char *)malloc(file_size + 1);
-        if (!src_code) {
-                perror("Failed to allocate memory for source code");
+        int ok = lexed == 0 && !stream.error;
+        if (lexed < 0)
+                perror("Failed to lex source file");
+        else if (!ok)
+                perror("Failed to read source file");
+        lexer_stream_destroy(&stream);
+        fclose(symbol_table_file);
+        if (!standard_input)
                 fclose(source_file);
-                return NULL;
+        return ok;
+#endif
+}
+
+/*
+ * lexes and parses every source of a directory or list file on threads
+ * threads, all cores if it is 0. the symbol tables all go to
+ * symbol_table.txt, see batch_run()
+ */
+int batch_symbol_tables(const char *path, unsigned threads, int memoize)
+{
+        struct BatchSources sources;
+        if (batch_sources_collect(&sources, path) != 0) {
+                perror("Failed to list source files");
+                batch_sources_destroy(&sources);
+                return 0;
+        }
+
+        FILE *symbol_table_file = fopen("symbol_table.txt", "w");
+        if (!symbol_table_file) {
+                perror("Failed to open symbol table file");
+                batch_sources_destroy(&sources);
+                return 0;
         }
 
-        size_t read_size = fread(src_code, 1, file_size, source_file);
-        src_code[read_size] = '\0';
-        fclose(source_file);
+        if (threads == 0)
+                threads = (unsigned)sysconf(_SC_NPROCESSORS_ONLN);
+        size_t failed = batch_run(&sources,
+                                  threads,
+                                  memoize,
+                                  symbol_table_file,
+                                  stderr);
+        if (failed > 0)
+                fprintf(stderr,
+                        "%zu of %zu source files failed\n",
+                        failed,
+                        sources.size);
 
-        return src_code;
+        fclose(symbol_table_file);
+        batch_sources_destroy(&sources);
+        return 1;
 }
 
 int main(int argc, char **argv)
 {
-        if (argc < 2) {
-                printf("Usage: %s <source_file>\n", argv[0]);
+        int memoize = 0;
+        int stream = 0;
+        int batch = 0;
+        // a batch runs on every core and a single source on one thread
+        // unless --threads says otherwise, 0 being every core
+        unsigned threads = 0;
+        int arg = 1;
+        for (; arg < argc - 1; arg++) {
+                if (strcmp(argv[arg], "--memoize") == 0)
+                        memoize = 1;
+                else if (strcmp(argv[arg], "--stream") == 0)
+                        stream = 1;
+                else if (strcmp(argv[arg], "--batch") == 0)
+                        batch = 1;
+                else if (strcmp(argv[arg], "--threads") == 0 &&
+                         arg + 1 < argc - 1) {
+                        threads = (unsigned)strtoul(argv[++arg], NULL, 10);
+                        if (threads == 0)
+                                threads = (unsigned)sysconf(
+                                    _SC_NPROCESSORS_ONLN);
+                }
+                else
+                        break;
+        }
+        if (arg != argc - 1) {
+                printf("Usage: %s [--memoize] [--stream] [--batch]"
+                       " [--threads <n>]"
+                       " <source_file | directory | list | ->\n",
+                       argv[0]);
                 return 1;
         }
 
-        char *src_code = read_file(argv[1]);
-        if (!src_code) {
+        if (batch)
+                return batch_symbol_tables(argv[arg], threads, memoize) ? 0
+                                                                         : 1;
+        if (stream)
+                return stream_symbol_table(argv[arg]) ? 0 : 1;
+
+        struct SourceBuffer source;
+        if (read_file(argv[arg], &source) != 0) {
+                return 1;
+        }
+
+        FILE *symbol_table_file = fopen("symbol_table.txt", "w");
+        if (!symbol_table_file) {
+                perror("Failed to open symbol table file");
+                source_buffer_release(&source);
                 return 1;
         }
 
         struct Lexer lexer;
-        lexer_init(&lexer, src_code);
-        lexer_lex(&lexer);
-        lexer_print_toks(&lexer);
+        if (lexer_init(&lexer, source.text, source.size) != 0) {
+                perror("Failed to lex source file");
+                exit(EXIT_FAILURE);
+        }
+        lexer.memoize = memoize;
+        lexer.threads = threads ? threads : 1;
+        if (lexer_lex(&lexer) != 0) {
+                perror("Failed to lex source file");
+                exit(EXIT_FAILURE);
+        }
+        lexer_print_toks(symbol_table_file, &lexer.tokens);
+        fclose(symbol_table_file);
 
-        ASTNode *ast = parse(lexer.tokens);
+        ASTNode *ast = parse(&lexer.tokens);
         if (ast) {
                 ast_print(ast);
                 ast_node_free(ast);
@@ -77,5 +212,7 @@ int main(int argc, char **argv)
                 fprintf(stderr, "Parsing failed due to errors.\n");
         }
 
+        lexer_destroy(&lexer);
+        source_buffer_release(&source);
         return 0;
 }
\ No newline at end of file
@@ -10,7 +10,7 @@
 
 /* parser lifetime handling */
 
-Parser *parser_create(struct TokenList *toks)
+Parser *parser_create(struct TokenBuffer *toks)
 {
         if (!toks) {
                 fprintf(stderr, "null tokenlist in parser_create\n");
@@ -27,6 +27,7 @@ Parser *parser_create(struct TokenList *toks)
         p->curr = 0;
         p->has_error = false;
         p->panic_mode = false;
+        p->errors = stderr;
 
         return p;
 }
@@ -42,29 +43,73 @@ void parser_free(Parser *p)
 
 /* helper functions */
 
-static struct Token *curr(Parser *p)
+/* tokens are indices into p->toks, NO_TOKEN past either end */
+#define NO_TOKEN ((size_t)-1)
+
+static size_t curr(Parser *p)
 {
-        return token_list_get(p->toks, p->curr);
+        return p->curr < p->toks->size ? p->curr : NO_TOKEN;
 }
 
-static struct Token *prev(Parser *p)
+static size_t prev(Parser *p)
 {
         if (p->curr == 0) {
-                return NULL;
+                return NO_TOKEN;
         }
-        return token_list_get(p->toks, p->curr - 1);
+        return p->curr - 1;
 }
 
 static bool is_at_end(Parser *p)
 {
-        struct Token *tok = curr(p);
-        return tok == NULL;
+        return curr(p) == NO_TOKEN;
+}
+
+/**
+ * UNKNOWN for NO_TOKEN, which matches nothing the parser checks for
+ */
+static TokenType type_of(Parser *p, size_t tok)
+{
+        return tok != NO_TOKEN ? p->toks->kinds[tok] : UNKNOWN;
+}
+
+/**
+ * line and column of the token for an error message, -1 for NO_TOKEN
+ */
+static void position_of(Parser *p, size_t tok, int *line, int *col)
+{
+        if (tok == NO_TOKEN) {
+                *line = -1;
+                *col = -1;
+                return;
+        }
+        token_buffer_position(p->toks, tok, line, col);
+}
+
+/**
+ * NUL-terminated copy of the token's lexeme, freed with the token buffer.
+ * the nodes made from it borrow it rather than copying it again. if it
+ * can't be allocated the parse fails like on a syntax error
+ */
+static char *lexeme_of(Parser *p, size_t tok)
+{
+        char *lexeme = token_buffer_lexeme(p->toks, tok);
+        if (!lexeme) {
+                int line, col;
+                position_of(p, tok, &line, &col);
+                fprintf(p->errors,
+                        "parse error at line %d, col %d: out of memory for "
+                        "lexeme.\n",
+                        line,
+                        col);
+                p->has_error = true;
+        }
+        return lexeme;
 }
 
 /**
  * get current token and advance parser current
  */
-static struct Token *advance(Parser *p)
+static size_t advance(Parser *p)
 {
         if (!is_at_end(p)) {
                 p->curr++;
@@ -81,8 +126,7 @@ static bool check(Parser *p, TokenType type)
         if (is_at_end(p)) {
                 return false;
         }
-        struct Token *tok = curr(p);
-        return tok->type == type;
+        return type_of(p, curr(p)) == type;
 }
 
 /**
@@ -122,20 +166,22 @@ static bool match_any(Parser *p, int count, ...)
 /**
  * consume expected token, report error otherwise
  */
-static struct Token *consume(Parser *p, TokenType type, const char *msg)
+static bool consume(Parser *p, TokenType type, const char *msg)
 {
         if (check(p, type)) {
-                return advance(p);
+                advance(p);
+                return true;
         }
 
-        struct Token *tok = curr(p);
-        fprintf(stderr,
+        int line, col;
+        position_of(p, curr(p), &line, &col);
+        fprintf(p->errors,
                 "parse error at line %d, col %d: %s.\n",
-                tok ? tok->line : -1,
-                tok ? tok->col : -1,
+                line,
+                col,
                 msg);
         p->has_error = true;
-        return NULL;
+        return false;
 }
 
 static void err_at_curr(Parser *p, const char *msg)
@@ -146,14 +192,19 @@ static void err_at_curr(Parser *p, const char *msg)
         p->panic_mode = true;
         p->has_error = true;
 
-        struct Token *tok = curr(p);
-        fprintf(stderr,
-                "parse error at line %d, col %d: %s. got '%s' of type '%s'.\n",
-                tok ? tok->line : -1,
-                tok ? tok->col : -1,
+        size_t tok = curr(p);
+        int line, col;
+        position_of(p, tok, &line, &col);
+        fprintf(p->errors,
+                "parse error at line %d, col %d: %s. got '%.*s' of type "
+                "'%s'.\n",
+                line,
+                col,
                 msg,
-                tok ? tok->lexeme : "NULL",
-                tok ? tok_type_to_str(tok->type) : "NULL");
+                tok != NO_TOKEN ? (int)p->toks->lengths[tok] : 4,
+                tok != NO_TOKEN ? p->toks->source + p->toks->offsets[tok]
+                                : "NULL",
+                tok != NO_TOKEN ? tok_type_to_str(type_of(p, tok)) : "NULL");
 }
 
 static void synchronize(Parser *p)
@@ -161,10 +212,10 @@ static void synchronize(Parser *p)
         p->panic_mode = false;
 
         while (!is_at_end(p)) {
-                if (prev(p)->type == SEMI_COLON)
+                if (type_of(p, prev(p)) == SEMI_COLON)
                         return;
 
-                switch (curr(p)->type) {
+                switch (type_of(p, curr(p))) {
                 case IF_TOK:
                 case ELIF_TOK:
                 case ELSE_TOK:
@@ -188,7 +239,7 @@ static void synchronize(Parser *p)
 
 static bool is_stmt_start(Parser *p)
 {
-        TokenType type = curr(p)->type;
+        TokenType type = type_of(p, curr(p));
         return type == IF_TOK || type == WHILE_TOK || type == FOR_TOK ||
             type == PRINT_TOK || type == LEFT_CURLY_BRACE ||
             type == SEMI_COLON || type == IDENTIFIER || type == INT_TOK ||
@@ -210,6 +261,7 @@ static ASTNode *parse_program(Parser *p)
                 return NULL;
 
         while (!is_at_end(p)) {
+                size_t start = p->curr;
                 ASTNode *stmt = parse_stmt(p);
                 if (stmt) {
                         stmt_list_add(stmts, stmt);
@@ -217,6 +269,10 @@ static ASTNode *parse_program(Parser *p)
                 if (p->has_error) {
                         synchronize(p);
                 }
+                // a statement that fails on a token synchronize() stops at
+                // would be retried forever
+                if (p->curr == start)
+                        advance(p);
         }
 
         return node_program_create(stmts);
@@ -234,6 +290,7 @@ static ASTNode *parse_stmt_block(Parser *p)
                 return NULL;
 
         while (!check(p, RIGHT_CURLY_BRACE) && !is_at_end(p)) {
+                size_t start = p->curr;
                 ASTNode *stmt = parse_stmt(p);
                 if (stmt) {
                         stmt_list_add(stmts, stmt);
@@ -241,6 +298,10 @@ static ASTNode *parse_stmt_block(Parser *p)
                 if (p->has_error) {
                         synchronize(p);
                 }
+                // a statement that fails on a token synchronize() stops at
+                // would be retried forever
+                if (p->curr == start)
+                        advance(p);
         }
 
         if (!consume(p,
@@ -274,12 +335,12 @@ static ASTNode *parse_decl(Parser *p)
 {
         DataType type = parse_type(p);
 
-        struct Token *ident_tok =
-            consume(p, IDENTIFIER, "expected identifier in declaration");
-        if (!ident_tok)
+        if (!consume(p, IDENTIFIER, "expected identifier in declaration"))
                 return NULL;
 
-        char *ident = ident_tok->lexeme;
+        char *ident = lexeme_of(p, prev(p));
+        if (!ident)
+                return NULL;
         ASTNode *init_expr = NULL;
 
         if (match(p, ASSIGN)) {
@@ -293,10 +354,9 @@ static ASTNode *parse_decl(Parser *p)
 
 static ASTNode *parse_assign(Parser *p)
 {
-        struct Token *ident_tok =
-            consume(p, IDENTIFIER, "expected identifier in assignment");
-        if (!ident_tok)
+        if (!consume(p, IDENTIFIER, "expected identifier in assignment"))
                 return NULL;
+        size_t ident_tok = prev(p);
 
         if (!consume(p, ASSIGN, "expected '=' in assignment")) {
                 return NULL;
@@ -306,27 +366,34 @@ static ASTNode *parse_assign(Parser *p)
                 if (!consume(p, LEFT_PARENTHESIS, "expected ')' after 'input'"))
                         return NULL;
 
-                struct Token *prompt_tok =
-                    consume(p,
-                            STRING_LITERAL,
-                            "expected string literal for input prompt");
-                if (!prompt_tok)
+                if (!consume(p,
+                             STRING_LITERAL,
+                             "expected string literal for input prompt"))
                         return NULL;
+                size_t prompt_tok = prev(p);
 
                 if (!consume(p,
                              RIGHT_PARENTHESIS,
                              "expected ')' after input prompt"))
                         return NULL;
 
-                return node_input_assign_create(ident_tok->lexeme,
-                                                prompt_tok->lexeme);
+                char *ident = lexeme_of(p, ident_tok);
+                char *prompt = lexeme_of(p, prompt_tok);
+                if (!ident || !prompt)
+                        return NULL;
+                return node_input_assign_create(ident, prompt);
         }
 
         ASTNode *expr = parse_expr(p);
         if (!expr)
                 return NULL;
 
-        return node_assign_create(ident_tok->lexeme, expr);
+        char *ident = lexeme_of(p, ident_tok);
+        if (!ident) {
+                ast_node_free(expr);
+                return NULL;
+        }
+        return node_assign_create(ident, expr);
 }
 
 static ASTNode *parse_if_stmt(Parser *p)
@@ -500,9 +567,9 @@ static ASTNode *parse_for(Parser *p)
         ASTNode *iter = NULL;
         if (!check(p, RIGHT_PARENTHESIS)) {
                 if (check(p, IDENTIFIER)) {
-                        struct Token *next =
-                            token_list_get(p->toks, p->curr + 1);
-                        if (next && next->type == ASSIGN) {
+                        size_t next = p->curr + 1;
+                        if (next < p->toks->size &&
+                            type_of(p, next) == ASSIGN) {
                                 // TODO: SKETCHY, DOUBLE CHECK IF WORKING
                                 // advance(p); // consume ident
                                 iter = parse_assign(p);
@@ -634,8 +701,8 @@ static ASTNode *parse_stmt(Parser *p)
 
         // check next for assign token to differentiate vs expr
         if (check(p, IDENTIFIER)) {
-                struct Token *next = token_list_get(p->toks, p->curr + 1);
-                if (next && next->type == ASSIGN) {
+                size_t next = p->curr + 1;
+                if (next < p->toks->size && type_of(p, next) == ASSIGN) {
                         // TODO: SKETCHY, CHECK IF PROPER
                         // advance(p);
                         ASTNode *assign = parse_assign(p);
@@ -949,48 +1016,58 @@ static ASTNode *parse_unary(Parser *p)
 static ASTNode *parse_primary(Parser *p)
 {
         if (match(p, INT_LITERAL)) {
+                char *lexeme = lexeme_of(p, prev(p));
+                if (!lexeme)
+                        return NULL;
                 LiteralValue val;
-                val.int_val = atoi(prev(p)->lexeme);
+                val.int_val = atoi(lexeme);
                 return node_literal_create(TYPE_INT, val);
         }
 
         if (match(p, FLOAT_LITERAL)) {
+                char *lexeme = lexeme_of(p, prev(p));
+                if (!lexeme)
+                        return NULL;
                 LiteralValue val;
-                val.float_val = atof(prev(p)->lexeme);
+                val.float_val = atof(lexeme);
                 return node_literal_create(TYPE_FLOAT, val);
         }
 
         if (match(p, BOOL_LITERAL)) {
                 LiteralValue val;
-                val.bool_val = strcmp(prev(p)->lexeme, "true") == 0;
+                val.bool_val = p->toks->lengths[prev(p)] == 4 &&
+                               memcmp(p->toks->source +
+                                          p->toks->offsets[prev(p)],
+                                      "true",
+                                      4) == 0;
                 return node_literal_create(TYPE_BOOL, val);
         }
 
         if (match(p, CHAR_LITERAL)) {
                 LiteralValue val;
                 // remember char lexeme is stored as 'c'
-                val.char_val = prev(p)->lexeme[1];
+                val.char_val = p->toks->source[p->toks->offsets[prev(p)] + 1];
                 return node_literal_create(TYPE_CHAR, val);
         }
 
         if (match(p, STRING_LITERAL)) {
-                LiteralValue val;
-                size_t len = strlen(prev(p)->lexeme);
-                // Allocate memory for the string (excluding quotes)
-                val.str_val =
-                    malloc(len - 1); // -2 for quotes, +1 for null terminator
-                if (!val.str_val) {
-                        fprintf(stderr, "malloc failed for string literal\n");
+                char *lexeme = lexeme_of(p, prev(p));
+                if (!lexeme)
                         return NULL;
-                }
-                strncpy(val.str_val, prev(p)->lexeme + 1, len - 2);
-                val.str_val[len - 2] = '\0';
+                // the quotes are cut off the copy in place, and the node
+                // borrows what is left
+                size_t len = p->toks->lengths[prev(p)];
+                lexeme[len - 1] = '\0';
+                LiteralValue val;
+                val.str_val = lexeme + 1;
                 return node_literal_create(TYPE_STRING, val);
         }
 
         // differentiate between normal identifier vs func-call
         if (match(p, IDENTIFIER)) {
-                char *name = prev(p)->lexeme;
+                char *name = lexeme_of(p, prev(p));
+                if (!name)
+                        return NULL;
 
                 if (match(p, LEFT_PARENTHESIS)) {
                         ArgNode *args = NULL;
@@ -1059,12 +1136,18 @@ static ASTNode *parse_expr(Parser *p)
         return parse_lor(p);
 }
 
-ASTNode *parse(struct TokenList *toks)
+ASTNode *parse(struct TokenBuffer *toks)
+{
+        return parse_reporting(toks, stderr);
+}
+
+ASTNode *parse_reporting(struct TokenBuffer *toks, FILE *errors)
 {
         Parser *p = parser_create(toks);
         if (!p) {
                 return NULL;
         }
+        p->errors = errors;
 
         ASTNode *ast = parse_program(p);
         bool has_error = p->has_error;
@@ -2,20 +2,32 @@
 #define PARSER_H
 
 #include <stdbool.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include "ast_node.h"
 #include "token.h"
 
 typedef struct Parser {
-        struct TokenList *toks;
+        struct TokenBuffer *toks;
         size_t curr;
         bool has_error;
         bool panic_mode;
+
+        FILE *errors;
 } Parser;
 
-Parser *parser_create(struct TokenList *toks);
+Parser *parser_create(struct TokenBuffer *toks);
 void parser_free(Parser *p);
 
-ASTNode *parse(struct TokenList *toks);
+/**
+ * the AST borrows its names and strings from the arena of toks, so it must
+ * be freed before toks is destroyed.
+ */
+ASTNode *parse(struct TokenBuffer *toks);
+
+/**
+ * parse() with the parse errors reported to errors instead of stderr.
+ */
+ASTNode *parse_reporting(struct TokenBuffer *toks, FILE *errors);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,124 @@
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "source_buffer.h"
+
+/* bytes read at a time when the source is not mapped */
+#define SOURCE_READ_CHUNK (64 * 1024)
+
+static int source_map(struct SourceBuffer *source, int fd, size_t size)
+{
+        // reserve at least one byte past the file, zero filled, and map the
+        // file over the front of it. the bytes after the end of the file in
+        // its last page read as zero as well, so the sentinel costs no copy
+        size_t page = (size_t)sysconf(_SC_PAGESIZE);
+        size_t reserved = (size / page + 1) * page;
+        void *addr = mmap(NULL,
+                          reserved,
+                          PROT_READ,
+                          MAP_PRIVATE | MAP_ANONYMOUS,
+                          -1,
+                          0);
+        if (addr == MAP_FAILED)
+                return -1;
+        if (mmap(addr, size, PROT_READ, MAP_PRIVATE | MAP_FIXED, fd, 0) ==
+            MAP_FAILED) {
+                munmap(addr, reserved);
+                return -1;
+        }
+        madvise(addr, size, MADV_SEQUENTIAL);
+
+        source->mapping = addr;
+        source->mapping_size = reserved;
+        source->text = (const char *)addr;
+        source->size = size;
+        return 0;
+}
+
+static int source_read(struct SourceBuffer *source, int fd)
+{
+        size_t capacity = SOURCE_READ_CHUNK;
+        size_t size = 0;
+        char *text = (char *)malloc(capacity);
+        if (!text)
+                return -1;
+
+        for (;;) {
+                // one byte is kept spare for the sentinel
+                if (capacity - size < SOURCE_READ_CHUNK + 1) {
+                        capacity *= 2;
+                        char *grown = (char *)realloc(text, capacity);
+                        if (!grown) {
+                                free(text);
+                                return -1;
+                        }
+                        text = grown;
+                }
+
+                ssize_t n = read(fd, text + size, SOURCE_READ_CHUNK);
+                if (n < 0 && errno == EINTR)
+                        continue;
+                if (n < 0) {
+                        int saved = errno;
+                        free(text);
+                        errno = saved;
+                        return -1;
+                }
+                if (n == 0)
+                        break;
+                size += (size_t)n;
+        }
+
+        text[size] = '\0';
+        source->text = text;
+        source->size = size;
+        return 0;
+}
+
+int source_buffer_load(struct SourceBuffer *source, const char *filename)
+{
+        source->text = NULL;
+        source->size = 0;
+        source->mapping = NULL;
+        source->mapping_size = 0;
+
+        int standard_input = strcmp(filename, "-") == 0;
+        int fd = standard_input ? STDIN_FILENO : open(filename, O_RDONLY);
+        if (fd == -1)
+                return -1;
+
+        struct stat st;
+        int result;
+        if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+                // not every file maps
+                result = source_map(source, fd, (size_t)st.st_size);
+                if (result != 0)
+                        result = source_read(source, fd);
+        } else {
+                result = source_read(source, fd);
+        }
+
+        if (!standard_input) {
+                int saved = errno;
+                close(fd);
+                errno = saved;
+        }
+        return result;
+}
+
+void source_buffer_release(struct SourceBuffer *source)
+{
+        if (source->mapping)
+                munmap(source->mapping, source->mapping_size);
+        else
+                free((char *)source->text);
+
+        source->text = NULL;
+        source->size = 0;
+        source->mapping = NULL;
+        source->mapping_size = 0;
+}
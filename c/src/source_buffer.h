@@ -0,0 +1,39 @@
+#ifndef SOURCE_BUFFER_H
+#define SOURCE_BUFFER_H
+
+#include <stddef.h>
+
+/**
+ * Contents of a source file followed by a NUL sentinel, so they can be
+ * handed to lexer_init() as they are. A regular file is mapped read-only and
+ * read ahead sequentially, so it is never copied. Pipes, stdin and files
+ * that report no size, like the ones in /proc, are read into memory instead.
+ *
+ * Members:
+ * - text: The contents, text[size] is '\0'.
+ * - size: Length of the contents, not counting the sentinel.
+ * - mapping, mapping_size: The mapped range, or NULL and 0 if text was read
+ * into memory.
+ */
+struct SourceBuffer {
+        const char *text;
+        size_t size;
+
+        void *mapping;
+        size_t mapping_size;
+};
+
+/**
+ * Loads filename into source, or stdin if filename is "-".
+ *
+ * Returns 0 on success, or -1 with errno set if the file can't be opened or
+ * read.
+ */
+int source_buffer_load(struct SourceBuffer *source, const char *filename);
+
+/**
+ * Unmaps or frees the contents of a loaded source.
+ */
+void source_buffer_release(struct SourceBuffer *source);
+
+#endif
@@ -28,59 +28,101 @@ void token_destroy(struct Token *token)
         free(token);
 }
 
-struct TokenList *token_list_create()
+/* expected source bytes per token, whitespace and comments included, to
+ * size the arrays of a new buffer */
+#define TOKEN_BUFFER_BYTES_PER_TOKEN 8
+
+/* carves arrays for capacity tokens out of the arena */
+static int token_buffer_alloc(struct TokenBuffer *buf, size_t capacity)
 {
-        struct TokenList *list = malloc(sizeof(struct TokenList));
-        if (!list)
-                return NULL;
+        TokenType *kinds = (TokenType *)arena_alloc(
+            &buf->arena, capacity * sizeof(*buf->kinds));
+        uint32_t *offsets = (uint32_t *)arena_alloc(
+            &buf->arena, capacity * sizeof(*buf->offsets));
+        uint32_t *lengths = (uint32_t *)arena_alloc(
+            &buf->arena, capacity * sizeof(*buf->lengths));
+        if (!kinds || !offsets || !lengths)
+                return -1;
 
-        list->size = 0;
-        list->capacity = 16; // initial capacity, will change as needed
-        list->tokens = malloc(list->capacity * sizeof(struct Token *));
-        if (!list->tokens) {
-                free(list);
-                return NULL;
+        if (buf->size > 0) {
+                memcpy(kinds, buf->kinds, buf->size * sizeof(*kinds));
+                memcpy(offsets, buf->offsets, buf->size * sizeof(*offsets));
+                memcpy(lengths, buf->lengths, buf->size * sizeof(*lengths));
         }
 
-        return list;
+        buf->kinds = kinds;
+        buf->offsets = offsets;
+        buf->lengths = lengths;
+        buf->capacity = capacity;
+        return 0;
 }
 
-void token_list_destroy(struct TokenList *list)
+int token_buffer_init(struct TokenBuffer *buf,
+                      const char *source,
+                      size_t length)
 {
-        if (!list)
-                return;
-
-        for (size_t i = 0; i < list->size; i++) {
-                token_destroy(list->tokens[i]);
+        arena_init(&buf->arena);
+        buf->source = source;
+        buf->source_length = length;
+        buf->line_index.starts = NULL;
+        buf->line_index.count = 0;
+        buf->kinds = NULL;
+        buf->offsets = NULL;
+        buf->lengths = NULL;
+        buf->size = 0;
+        buf->capacity = 0;
+
+        if (token_buffer_alloc(buf,
+                               length / TOKEN_BUFFER_BYTES_PER_TOKEN + 16) !=
+            0) {
+                arena_destroy(&buf->arena);
+                return -1;
         }
-        free(list->tokens);
-        free(list);
+        return 0;
 }
 
-int token_list_insert(struct TokenList *list, struct Token *token)
+void token_buffer_destroy(struct TokenBuffer *buf)
 {
-        if (!list || !token)
-                return -1;
-
-        if (list->size >= list->capacity) {
-                list->capacity = list->capacity * 2;
-                struct Token **new_toks = realloc(
-                    list->tokens, list->capacity * sizeof(struct Token *));
+        arena_destroy(&buf->arena);
+        buf->line_index.starts = NULL;
+        buf->size = 0;
+        buf->capacity = 0;
+}
 
-                if (!new_toks)
-                        return -1;
+int token_buffer_grow(struct TokenBuffer *buf)
+{
+        return token_buffer_alloc(buf, 2 * buf->capacity);
+}
 
-                list->tokens = new_toks;
-        }
+char *token_buffer_lexeme(struct TokenBuffer *buf, size_t i)
+{
+        char *lexeme = (char *)arena_alloc(&buf->arena, buf->lengths[i] + 1);
+        if (!lexeme)
+                return NULL;
 
-        list->tokens[list->size++] = token;
-        return list->size - 1;
+        memcpy(lexeme, buf->source + buf->offsets[i], buf->lengths[i]);
+        lexeme[buf->lengths[i]] = '\0';
+        return lexeme;
 }
 
-struct Token *token_list_get(struct TokenList *list, size_t idx)
+int token_buffer_position(struct TokenBuffer *buf,
+                          size_t i,
+                          int *line,
+                          int *col)
 {
-        if (!list || idx >= list->size)
-                return NULL;
+        if (!buf->line_index.starts &&
+            line_index_build(&buf->line_index,
+                             &buf->arena,
+                             buf->source,
+                             buf->source_length) != 0) {
+                *line = -1;
+                *col = -1;
+                return -1;
+        }
 
-        return list->tokens[idx];
-}
\ No newline at end of file
+        size_t l, c;
+        line_index_position(&buf->line_index, buf->offsets[i], &l, &c);
+        *line = (int)l;
+        *col = (int)c;
+        return 0;
+}
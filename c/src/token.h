@@ -1,7 +1,10 @@
 #ifndef TOKEN_H
 #define TOKEN_H
 
+#include <stdint.h>
 #include <stdlib.h>
+#include "arena.h"
+#include "line_index.h"
 #include "transition_table.h"
 
 /**
@@ -34,45 +37,99 @@ token_create(TokenType type, const char *lexeme, int line, int col);
 void token_destroy(struct Token *token);
 
 /**
- * Dynamically allocated list of Tokens.
- * Requires freeing with token_list_destroy().
+ * Tokens of a source as parallel arrays, one entry per token in each. Tokens
+ * refer to the source by offset instead of copying their lexemes, so the
+ * source must outlive the buffer. The arrays are carved out of arena, and so
+ * is every lexeme copy made with token_buffer_lexeme(), so adding a token
+ * allocates nothing until the arrays are full.
+ * Requires freeing with token_buffer_destroy().
+ *
+ * Lines and columns are not stored. token_buffer_position() finds them from
+ * the offset when they are needed, with a line index of the source that it
+ * builds on its first call.
  *
  * Members:
- * - tokens: Array of pointers to Token.
- * - size: Current number of tokens in the list.
- * - capacity: Current allocated capacity of the list.
+ * - arena: Where the arrays, line index and lexeme copies live.
+ * - source, source_length: The source the offsets are into.
+ * - line_index: Line starts of source, starts is NULL until first needed.
+ * - kinds: Type of each token.
+ * - offsets, lengths: Where each lexeme is in source.
+ * - size: Current number of tokens in the buffer.
+ * - capacity: Number of tokens the arrays have room for.
  */
-struct TokenList {
-        struct Token **tokens;
+struct TokenBuffer {
+        struct Arena arena;
+        const char *source;
+        size_t source_length;
+        struct LineIndex line_index;
+
+        TokenType *kinds;
+        uint32_t *offsets;
+        uint32_t *lengths;
+
         size_t size;
         size_t capacity;
 };
 
 /**
- * Creates a new pointer to a dynamically allocated TokenList.
- * See token_list_destroy() for freeing.
+ * Initializes an empty buffer for the tokens of source[0, length). The
+ * arrays are sized from length, so most sources never grow them.
  *
- * Returns a pointer to the created TokenList, or NULL on failure.
+ * Returns 0 on success, or -1 if the arrays can't be allocated.
  */
-struct TokenList *token_list_create();
+int token_buffer_init(struct TokenBuffer *buf,
+                      const char *source,
+                      size_t length);
 
 /**
- * Frees a dynamically allocated TokenList and all its Tokens.
+ * Frees the arrays and lexeme copies of buf, the source is left alone.
  */
-void token_list_destroy(struct TokenList *list);
+void token_buffer_destroy(struct TokenBuffer *buf);
 
 /**
- * Inserts a Token pointer into the TokenList.
+ * Moves the tokens to arrays of twice the capacity. Called by
+ * token_buffer_push(), the old arrays stay in the arena until it is freed.
  *
- * Returns the index of the inserted token, or -1 on failure.
+ * Returns 0 on success, or -1 if the new arrays can't be allocated.
+ */
+int token_buffer_grow(struct TokenBuffer *buf);
+
+/**
+ * Appends a token of type kind for source[offset, offset + length).
+ *
+ * Returns 0 on success, or -1 if the buffer is full and can't grow.
+ */
+static inline int token_buffer_push(struct TokenBuffer *buf,
+                                    TokenType kind,
+                                    uint32_t offset,
+                                    uint32_t length)
+{
+        if (buf->size == buf->capacity && token_buffer_grow(buf) != 0)
+                return -1;
+
+        size_t i = buf->size++;
+        buf->kinds[i] = kind;
+        buf->offsets[i] = offset;
+        buf->lengths[i] = length;
+        return 0;
+}
+
+/**
+ * Returns a NUL-terminated copy of the lexeme of token i, allocated in the
+ * buffer's arena and freed with it, or NULL if it can't be allocated.
  */
-int token_list_insert(struct TokenList *list, struct Token *token);
+char *token_buffer_lexeme(struct TokenBuffer *buf, size_t i);
 
 /**
- * Retrieves a Token pointer from the TokenList by index.
+ * Stores the line and column of the first byte of token i, counting from 1,
+ * in *line and *col.
  *
- * Returns the Token pointer at the given index, or NULL if out of bounds.
+ * Returns 0 on success, or -1 and stores -1 in both if the line index can't
+ * be allocated.
  */
-struct Token *token_list_get(struct TokenList *list, size_t index);
+int token_buffer_position(struct TokenBuffer *buf,
+                          size_t i,
+                          int *line,
+                          int *col);
 
 #endif
\ No newline at end of file
@@ -1,3696 +1,1345 @@
 /* Generated transition table */
 
 #include <stddef.h>
+#include <string.h>
 #include "transition_table.h"
 
+#ifdef __SSE2__
+#include <immintrin.h>
+#ifdef __GNUC__
+#define ACCEL_HAVE_AVX2
+#endif
+#endif
+
 const char ALPHABET[SYMBOL_COUNT] = {
-        '\x00', '\x01', '\x02', '\x03', '\x04', '\x05', '\x06', '\x07', '\x08',
-        '\t',   '\n',   '\x0B', '\x0C', '\r',   '\x0E', '\x0F', '\x10', '\x11',
-        '\x12', '\x13', '\x14', '\x15', '\x16', '\x17', '\x18', '\x19', '\x1A',
-        '\x1B', '\x1C', '\x1D', '\x1E', '\x1F', ' ',    '!',    '\"',   '#',
-        '$',    '%',    '&',    '\'',   '(',    ')',    '*',    '+',    ',',
-        '-',    '.',    '/',    '0',    '1',    '2',    '3',    '4',    '5',
-        '6',    '7',    '8',    '9',    ':',    ';',    '<',    '=',    '>',
-        '?',    '@',    'A',    'B',    'C',    'D',    'E',    'F',    'G',
-        'H',    'I',    'J',    'K',    'L',    'M',    'N',    'O',    'P',
-        'Q',    'R',    'S',    'T',    'U',    'V',    'W',    'X',    'Y',
-        'Z',    '[',    '\\',   ']',    '^',    '_',    '`',    'a',    'b',
-        'c',    'd',    'e',    'f',    'g',    'h',    'i',    'j',    'k',
-        'l',    'm',    'n',    'o',    'p',    'q',    'r',    's',    't',
-        'u',    'v',    'w',    'x',    'y',    'z',    '{',    '|',    '}',
-        '~',    '\x7F'
+        '\x00', '\t', '\n', '!', '\"', '#', '%', '\'', '(', ')', '*', '+', ',',
+        '-', '.', '/', '0', ':', ';', '<', '=', '>', 'A', '[', ']', '_', 'a',
+        'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'k', 'l', 'm', 'n', 'o', 'p',
+        'r', 's', 't', 'u', 'v', 'w', 'x', 'y', 'z', '{', '}', '\x80'
+};
+
+const unsigned char SYMBOL_TO_ID[256] = {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 1, 3, 4, 5, 0, 6, 0, 7, 8, 9, 10, 11, 12, 13,
+        14, 15, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 17, 18, 19, 20, 21, 0,
+        0, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 23, 0, 24, 0, 25, 0, 26, 27, 28, 29,
+        30, 31, 32, 33, 34, 22, 35, 36, 37, 38, 39, 40, 22, 41, 42, 43, 44, 45,
+        46, 47, 48, 49, 50, 0, 51, 0, 0, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+        52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+        52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+        52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+        52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+        52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+        52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+        52, 52, 52, 52, 52, 52, 52, 52, 52, 52
 };
 
-const int SYMBOL_TO_ID[256] = {
-        0,   1,   2,   3,   4,   5,   6,   7,   8,   9,   10,  11,  12,  13,
-        14,  15,  16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,
-        28,  29,  30,  31,  32,  33,  34,  35,  36,  37,  38,  39,  40,  41,
-        42,  43,  44,  45,  46,  47,  48,  49,  50,  51,  52,  53,  54,  55,
-        56,  57,  58,  59,  60,  61,  62,  63,  64,  65,  66,  67,  68,  69,
-        70,  71,  72,  73,  74,  75,  76,  77,  78,  79,  80,  81,  82,  83,
-        84,  85,  86,  87,  88,  89,  90,  91,  92,  93,  94,  95,  96,  97,
-        98,  99,  100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
-        112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125,
-        126, 127, -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
-        -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
-        -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
-        -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
-        -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
-        -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
-        -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
-        -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
-        -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
-        -1,  -1,  -1,  -1
+const state_id_t TRANSITION_TABLE[STATE_COUNT][SYMBOL_COUNT] = {
+        { 255, 1, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 255, 13, 14, 15, 16,
+          17, 18, 19, 20, 21, 22, 255, 23, 24, 25, 26, 27, 28, 20, 20, 29, 20,
+          20, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 20, 20, 40, 41, 42, 255 },
+        { 255, 1, 1, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 43, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
+        { 44, 44, 255, 44, 45, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+          44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+          44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+          44, 255 },
+        { 4, 4, 255, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+          4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+          4, 4, 4, 4, 4, 4, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
+        { 46, 46, 255, 46, 46, 46, 46, 255, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+          46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+          46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+          46, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 47, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 48, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          49, 255, 14, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 50, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 51, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 52, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 53, 20, 20, 54, 55, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 56, 20, 57, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 58, 20, 20, 20, 20, 20, 59, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 60, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 61, 20, 62, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 63, 20, 20,
+          20, 20, 20, 20, 20, 64, 20, 65, 20, 20, 66, 20, 67, 20, 20, 68, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 69, 20, 20, 20, 20, 20, 70, 71, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 72, 20, 20,
+          20, 73, 20, 20, 20, 74, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 75, 20, 20, 20, 20, 76, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 77, 20, 20, 78, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 79, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 80, 20, 20,
+          20, 81, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 82, 20, 20, 83, 20, 20, 20, 84, 85, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 86, 20, 20, 87, 20, 20, 20, 20, 20, 88, 20, 89, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 90, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 91, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 92, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 93, 94, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 95, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
+        { 44, 44, 255, 44, 96, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+          44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+          44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+          44, 255 },
+        { 255, 255, 255, 255, 97, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 98, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 99, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          100, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 101, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 102, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 103, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 104, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 105, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 106, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 107, 20, 20, 20, 20, 20, 20, 20, 108, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          109, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 110, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 111, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 112, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 113, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 114, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 115, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 116, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 117, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 118, 20, 20, 119, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 120, 20, 20,
+          20, 121, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 122, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 123, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 124, 20, 125, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 126, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 127, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 128, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 129, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 130, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 131, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 132, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 133, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          134, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 135, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 136, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 137, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 138, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 139, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 140, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 141, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 142, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 143, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 144, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 145, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 146, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
+        { 97, 97, 97, 97, 147, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+          97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+          97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+          97, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 99, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 148, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 149, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 150, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 151, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 152,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 153, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 154, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 155, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 140, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 156, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 157, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 158, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 159, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 160,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 161, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 162, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 163, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 164, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 165, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 166, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 167, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 168, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          169, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          170, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 171, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 172,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 173, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 174, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 175, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 176, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 177, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 178, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 179, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          180, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 181, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 182, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 183, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 97, 97, 97, 97, 184, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+          97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+          97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+          97, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 185, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 186, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 187, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 188, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 189, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 190, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 191, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 192, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 193, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 194, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 195, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 196, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 197, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 198, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 199, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 200, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 201, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 202, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 203, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 204, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 205, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 206, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 97, 97, 97, 97, 207, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+          97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+          97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+          97, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 208, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 209, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 210, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 211, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 212, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 213, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 214, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 215,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 216, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 217, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 218, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 219, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 220, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 97, 97, 97, 97, 207, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+          97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+          97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+          97, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 221, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 222, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 223, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 224, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 225, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 226, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 227, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 228, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 229,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 230, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 231, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 232, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 233, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 },
+        { 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+          255, 255, 20, 255, 255, 255, 255, 255, 20, 255, 255, 20, 20, 20, 20,
+          20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+          20, 20, 20, 20, 255, 255, 255 }
 };
 
-const int TRANSITION_TABLE[STATE_COUNT][SYMBOL_COUNT] = {
-        { 1,  -1, -1, -1, -1, -1, -1, -1, -1, 2,  2,  2,  2,  2,  -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          2,  3,  4,  5,  -1, 6,  -1, 7,  8,  9,  10, 11, 12, 13, -1, 14,
-          15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 16, 17, 18, 19, 20, -1,
-          -1, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
-          21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 22, -1, 23, -1, -1,
-          -1, 24, 25, 26, 27, 28, 29, 21, 21, 30, 21, 21, 21, 31, 32, 33,
-          34, 21, 35, 36, 37, 38, 39, 40, 21, 21, 41, 42, -1, 43, -1, -1 },
-        { 44, -1, -1, -1, -1, -1, -1, -1, -1, 2,  2,  2,  2,  2,  -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          2,  3,  4,  5,  -1, 6,  -1, 7,  8,  9,  10, 11, 12, 13, -1, 14,
-          15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 16, 17, 18, 19, 20, -1,
-          -1, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
-          21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 22, -1, 23, -1, -1,
-          -1, 24, 25, 26, 27, 28, 29, 21, 21, 30, 21, 21, 21, 31, 32, 33,
-          34, 21, 35, 36, 37, 38, 39, 40, 21, 21, 41, 42, -1, 43, -1, -1 },
-        { 45, -1, -1, -1, -1, -1, -1, -1, -1, 2,  2,  2,  2,  2,  -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          2,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
-        { 46, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 47, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
-        { 48, 49, 49, 49, 49, 49, 49, 49, 49, 49, -1, 49, 49, 49, 49, 49,
-          49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
-          49, 49, 50, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
-          49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
-          49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
-          49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
-          49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
-          49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49 },
-        { 51, 52, 52, 52, 52, 52, 52, 52, 52, 52, -1, 52, 52, 52, 52, 52,
-          52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
-          52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
-          52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
-          52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
-          52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
-          52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
-          52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52 },
-        { 53, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
-        { 54, 55, 55, 55, 55, 55, 55, 55, 55, 55, -1, 55, 55, 55, 55, 55,
-          55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
-          55, 55, 55, 55, 55, 55, 55, -1, 55, 55, 55, 55, 55, 55, 55, 55,
-          55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
-          55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
-          55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
-          55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
-          55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55 },
-        { 53, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
-        { 56, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 57, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
-        { 58, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 59,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
-        { 60, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 61, -1,
-          15, 15, 15, 15, 15, 15, 15, 15, 15, 15, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
-        { 62, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 63, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
-        { 64, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 65, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
-        { 66, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 67, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
-        { 68, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
-        { 70, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 71, 69,
-          69, 69, 72, 73, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 74, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 75,
-          69, 69, 76, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 77, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69, 69, 69, 69, 69, 78, 69, 69, 69, 69, 69, 69, 79,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 80, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 81,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 82, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 83, 69, 84, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 85, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 86, 69, 69, 69, 69, 69, 69, 69, 87, 69, 69, 88, 69, 69, 89,
-          69, 69, 90, 69, 69, 91, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 92, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69, 69, 69, 93, 69, 69, 69, 69, 69, 69, 94, 95, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 96, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 97, 69, 69, 69, 98, 69, 69, 69, 99, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 100, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69,  69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 101,
-          69,  69, 69, 69, 69, 102, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 103, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          -1,  -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          -1,  -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          69,  69, 69,  69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1,  -1,
-          -1,  69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69,
-          69,  69, 69,  69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1,  69,
-          -1,  69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 104, 69,
-          69,  69, 105, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1,  -1 },
-        { 106, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69,  69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69,  69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 107, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 108, -1,  -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1,  -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1,  -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69,  69, 69, 69, 69,  69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69,  69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69,  69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  109, 69, 69, 69, 110, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69,  69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 111, -1, -1, -1, -1,  -1,  -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1,
-          -1,  -1, -1, -1, -1,  -1,  -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1,
-          -1,  -1, -1, -1, -1,  -1,  -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1,
-          69,  69, 69, 69, 69,  69,  69, 69, 69, 69, -1, -1, -1,  -1, -1, -1,
-          -1,  69, 69, 69, 69,  69,  69, 69, 69, 69, 69, 69, 69,  69, 69, 69,
-          69,  69, 69, 69, 69,  69,  69, 69, 69, 69, 69, -1, -1,  -1, -1, 69,
-          -1,  69, 69, 69, 69,  69,  69, 69, 69, 69, 69, 69, 112, 69, 69, 113,
-          69,  69, 69, 69, 114, 115, 69, 69, 69, 69, 69, -1, -1,  -1, -1, -1 },
-        { 116, -1, -1,  -1, -1, -1,  -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1,  -1, -1, -1,  -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1,  -1, -1, -1,  -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69,  69, 69, 69,  69, 69, 69,  69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69,  69, 69, 69,  69, 69, 69,  69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69,  69, 69, 69,  69, 69, 69,  69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69,  69, 69, 117, 69, 69, 118, 69, 69, 69, 69, 69, 69, 119,
-          69,  69, 120, 69, 69, 69,  69, 69, 69,  69, 69, -1, -1, -1, -1, -1 },
-        { 121, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69,  69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 122, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 123, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69,  69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  124, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 125,
-          69,  69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 126, -1, -1, -1, -1, -1, -1, -1, -1,  -1,  -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1,  -1,  -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1,  -1,  -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69,  69,  -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69,  69,  69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69,  69,  69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 127, 128, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69,  69,  69, -1, -1, -1, -1, -1 },
-        { 129, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69,  69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 130, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
-        { -1, -1, -1, -1, -1,  -1, -1,  -1, -1, 2,  2,  2,  2,  2,  -1, -1,
-          -1, -1, -1, -1, -1,  -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          2,  -1, -1, -1, -1,  -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          15, 15, 15, 15, 15,  15, 15,  15, 15, 15, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1,  -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1,  -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1,  -1, 131, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, 132, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1, -1, -1, -1, 2,  2,  2,  2,  2,  -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          2,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
-        { -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 47, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
-        { 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, -1, 49, 49, 49, 49, 49,
-          49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
-          49, 49, 50, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
-          49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
-          49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
-          49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
-          49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
-          49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49 },
-        { 49, 49, 49,  49, 49, 49, 49, 49, 49, 49, -1, 49, 49, 49, 49, 49,
-          49, 49, 49,  49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
-          49, 49, 133, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
-          49, 49, 49,  49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
-          49, 49, 49,  49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
-          49, 49, 49,  49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
-          49, 49, 49,  49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
-          49, 49, 49,  49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49 },
-        { 134, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, 135, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
-        { 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, -1, 52, 52, 52, 52, 52,
-          52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
-          52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
-          52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
-          52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
-          52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
-          52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
-          52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52 },
-        { 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, -1, 52, 52, 52, 52, 52,
-          52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
-          52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
-          52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
-          52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
-          52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
-          52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
-          52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52 },
-        { -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
-        { 55, 55, 55, 55, 55, 55, 55, 55,  55, 55, -1, 55, 55, 55, 55, 55,
-          55, 55, 55, 55, 55, 55, 55, 55,  55, 55, 55, 55, 55, 55, 55, 55,
-          55, 55, 55, 55, 55, 55, 55, 136, 55, 55, 55, 55, 55, 55, 55, 55,
-          55, 55, 55, 55, 55, 55, 55, 55,  55, 55, 55, 55, 55, 55, 55, 55,
-          55, 55, 55, 55, 55, 55, 55, 55,  55, 55, 55, 55, 55, 55, 55, 55,
-          55, 55, 55, 55, 55, 55, 55, 55,  55, 55, 55, 55, 55, 55, 55, 55,
-          55, 55, 55, 55, 55, 55, 55, 55,  55, 55, 55, 55, 55, 55, 55, 55,
-          55, 55, 55, 55, 55, 55, 55, 55,  55, 55, 55, 55, 55, 55, 55, 55 },
-        { 137, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, 136, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1 },
-        { -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 57, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
-        { -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 59,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
-        { 138, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 61, -1,
-          15,  15, 15, 15, 15, 15, 15, 15, 15, 15, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
-        { 139, -1, -1, -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1, -1,
-          -1,  -1, -1, -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1, -1,
-          -1,  -1, -1, -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1, -1,
-          -1,  -1, -1, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, -1, -1,
-          -1,  -1, -1, -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1, -1,
-          -1,  -1, -1, -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1, -1,
-          -1,  -1, -1, -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1, -1,
-          -1,  -1, -1, -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1, -1,
-          -1,  -1, -1, -1,  -1,  -1,  -1,  -1 },
-        { -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 63, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
-        { -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 65, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
-        { -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 67, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
-        { 141, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 141, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 141, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 71, 69,
-          69,  69, 72, 73, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 142, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 143, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 144, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69,  69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69,  69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 145, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 141, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 141, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 75,
-          69,  69, 76, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 146, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 147,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 148, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69,  69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 149, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 141, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 78, 69, 69, 69, 69, 69, 69, 79,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 150, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69,  69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  151, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 152, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1,  -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1,  69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 153, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1,  -1 },
-        { 141, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 81,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 154, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 155, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 141, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 83, 69, 84, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 156, -1, -1, -1,  -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1,  -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1,  -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69,  69, 69, 69, 69, 69, 69,  -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69,  69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69,  69, 69, 69, 69, 69, 69,  69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69,  69, 69, 69, 69, 69, 157, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 158, 69, 69, 69, 69, 69, 69,  69, -1, -1, -1, -1, -1 },
-        { 159, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 160, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 141, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  86, 69, 69, 69, 69, 69, 69, 69, 87, 69, 69, 88, 69, 69, 89,
-          69,  69, 90, 69, 69, 91, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 161, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1,  -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1,  -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 162, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1,  -1, -1, -1 },
-        { 163, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1,  -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1,  -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 164, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1,  -1, -1, -1 },
-        { 165, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69,  69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  166, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 167,
-          69,  69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 168, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69,  69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69,  69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 169, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 170, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 171,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 172, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1,  -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1,  69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 173, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1,  -1 },
-        { 141, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 93, 69, 69, 69, 69, 69, 69, 94, 95, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 141, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 174, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          175, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 176, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          177, 69, 69, 69, 178, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 141, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  97, 69, 69, 69, 98, 69, 69, 69, 99, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 179, -1, -1, -1, -1,  -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1,  -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1,  -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69,  69, 69, 69, 69,  69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69,  69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69,  69, 69, 69, 69,  69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69,  69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 180, 69, 69, 69, 181, 69, 69, -1, -1, -1, -1, -1 },
-        { 182, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69,  69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  183, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 184, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1,  -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1,  69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 185, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1,  -1 },
-        { 141, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69,  69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 101,
-          69,  69, 69, 69, 69, 102, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 186, -1, -1,  -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1,  -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1,  -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69,  69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69,  69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69,  69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69,  69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 187, 69, 188, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 189, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1,  -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1,  -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 190, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1,  -1, -1 },
-        { 141, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          -1,  -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          -1,  -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          69,  69, 69,  69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1,  -1,
-          -1,  69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69,
-          69,  69, 69,  69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1,  69,
-          -1,  69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 104, 69,
-          69,  69, 105, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1,  -1 },
-        { 191, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69,  69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 192, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 141, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 141, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69,  69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69,  69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 107, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 193, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69,  -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69,  69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 194, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69,  69, -1, -1, -1, -1, -1 },
-        { 141, -1,  -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1,  -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1,  -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69,  69, 69, 69, 69,  69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69,  69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69,  69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  109, 69, 69, 69, 110, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69,  69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 195, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1,  -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1,  69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 196, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1,  -1 },
-        { 197, -1,  -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1,  -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1,  -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69,  69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69,  69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69,  69, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  198, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69,  69, 69, 199, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 141, -1, -1, -1, -1,  -1,  -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1,
-          -1,  -1, -1, -1, -1,  -1,  -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1,
-          -1,  -1, -1, -1, -1,  -1,  -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1,
-          69,  69, 69, 69, 69,  69,  69, 69, 69, 69, -1, -1, -1,  -1, -1, -1,
-          -1,  69, 69, 69, 69,  69,  69, 69, 69, 69, 69, 69, 69,  69, 69, 69,
-          69,  69, 69, 69, 69,  69,  69, 69, 69, 69, 69, -1, -1,  -1, -1, 69,
-          -1,  69, 69, 69, 69,  69,  69, 69, 69, 69, 69, 69, 112, 69, 69, 113,
-          69,  69, 69, 69, 114, 115, 69, 69, 69, 69, 69, -1, -1,  -1, -1, -1 },
-        { 200, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69,  -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69,  69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 201, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69,  69, -1, -1, -1, -1, -1 },
-        { 202, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69,  69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69,  69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 203, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 204, -1, -1,  -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1,  -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1,  -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69,  69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69,  69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69,  69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69,  69, 205, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 206, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 207, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1,  -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1,  -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 208, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1,  -1, -1 },
-        { 141, -1, -1,  -1, -1, -1,  -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1,  -1, -1, -1,  -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1,  -1, -1, -1,  -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69,  69, 69, 69,  69, 69, 69,  69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69,  69, 69, 69,  69, 69, 69,  69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69,  69, 69, 69,  69, 69, 69,  69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69,  69, 69, 117, 69, 69, 118, 69, 69, 69, 69, 69, 69, 119,
-          69,  69, 120, 69, 69, 69,  69, 69, 69,  69, 69, -1, -1, -1, -1, -1 },
-        { 209, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1,  -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1,  69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 210, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1,  -1 },
-        { 211, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69,  69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 212, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 213, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 214,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 215, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69,  69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 216, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 141, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69,  69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 122, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 217, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69,  69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 218, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 141, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69,  69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  124, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 125,
-          69,  69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 219, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69,  69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69,  69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 220, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 221, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69,  -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69,  69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 222, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69,  69, -1, -1, -1, -1, -1 },
-        { 141, -1, -1, -1, -1, -1, -1, -1, -1,  -1,  -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1,  -1,  -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1,  -1,  -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69,  69,  -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69,  69,  69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69,  69,  69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 127, 128, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69,  69,  69, -1, -1, -1, -1, -1 },
-        { 223, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69,  -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69,  69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 224, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69,  69, -1, -1, -1, -1, -1 },
-        { 225, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 226, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 141, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69,  69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 130, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 227, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69,  69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69,  69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 228, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 229, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  230, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
-        { 231, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, 232, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
-        { -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, 135, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
-        { 233, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 235, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234 },
-        { 53, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
-        { -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, 136, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1 },
-        { -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 61, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
-        { 236, -1, -1, -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1, -1,
-          -1,  -1, -1, -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1, -1,
-          -1,  -1, -1, -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1, -1,
-          -1,  -1, -1, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, -1, -1,
-          -1,  -1, -1, -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1, -1,
-          -1,  -1, -1, -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1, -1,
-          -1,  -1, -1, -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1, -1,
-          -1,  -1, -1, -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1, -1,
-          -1,  -1, -1, -1,  -1,  -1,  -1,  -1 },
-        { 237, -1, -1, -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1, -1,
-          -1,  -1, -1, -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1, -1,
-          -1,  -1, -1, -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1, -1,
-          -1,  -1, -1, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, -1, -1,
-          -1,  -1, -1, -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1, -1,
-          -1,  -1, -1, -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1, -1,
-          -1,  -1, -1, -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1, -1,
-          -1,  -1, -1, -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1, -1,
-          -1,  -1, -1, -1,  -1,  -1,  -1,  -1 },
-        { 53, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69, 143, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 141, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69,  69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 145, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 238, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69,  69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  239, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 147,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 240, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1,  -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1,  -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 241, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1,  -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69, 69,  69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69, 69, 149, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 242, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69,  69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  243, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69,  69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 151, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 244, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69,  69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69,  69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 245, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1,  -1,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1,  69,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 153, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1,  -1 },
-        { 246, -1, -1, -1,  -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1,  -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1,  -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69,  69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69,  69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69,  69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 247, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69,  248, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 155, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 141, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1,  -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69,  69, 69, 69, 69, 69, 69,  -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69,  69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69,  69, 69, 69, 69, 69, 69,  69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69,  69, 69, 69, 69, 69, 157, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 158, 69, 69, 69, 69, 69, 69,  69, -1, -1, -1, -1, -1 },
-        { 249, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69,  69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69,  69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 250, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69,  69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 251, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69,  69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 252, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69, 160, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 141, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1,  -1, -1, -1,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1,  -1, -1, 69,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 162, 69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1,  -1, -1, -1 },
-        { 253, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69,  69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 254, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1,  -1, -1, -1,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1,  -1, -1, 69,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 164, 69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1,  -1, -1, -1 },
-        { 255, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 256, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69,  69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 166, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 167,
-          69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 257, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 258, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 259, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69,  69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  260, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69,  69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 169, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 141, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 171,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 261, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1,  -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1,  -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 262, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1,  -1, -1 },
-        { 53, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1,  -1,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1,  69,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 173, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1,  -1 },
-        { 263, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69,  69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 264, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69,  69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          175, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 265, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 266,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53,  -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          177, 69, 69, 69, 178, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 267, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69,  69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 268, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 141, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1,  -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1,  -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1,  -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69,  69, 69, 69, 69,  69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69,  69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69,  69, 69, 69, 69,  69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69, 69,  69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 180, 69, 69, 69, 181, 69, 69, -1, -1, -1, -1, -1 },
-        { 269, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69,  69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69,  69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 270, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 141, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69,  69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 183, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 271, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1,  -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1,  69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 272, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1,  -1 },
-        { 53, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1,  -1,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1,  69,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 185, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1,  -1 },
-        { 141, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1,  -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1,  -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1,  -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69,  69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69,  69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69,  69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69,  69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 187, 69, 188, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 273, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1,  -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1,  -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 274, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1,  -1, -1 },
-        { 141, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1,  -1, -1,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1,  -1, 69,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 190, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1,  -1, -1 },
-        { 275, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          276, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69, 69,  69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69, 69, 192, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 277, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69,  69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 278, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 194, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69, -1, -1, -1, -1, -1 },
-        { 279, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1,  -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1,  69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 280, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1,  -1 },
-        { 53, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1,  -1,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1,  69,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 196, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1,  -1 },
-        { 281, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 282, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1,  -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1,  -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1,  -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69,  69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69,  69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69,  69, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 198, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69,  69, 69, 199, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 283, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 284, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 285, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69,  69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 286, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 201, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69, -1, -1, -1, -1, -1 },
-        { 287, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69,  69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 288, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69,  69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69,  69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 203, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 289, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 290, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1,  -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1,  -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1,  -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69,  69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69,  69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69,  69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69,  69, 205, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 206, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 141, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 291, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69,  -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69,  69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 292, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69,  69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1,  -1, -1,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1,  -1, 69,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 208, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1,  -1, -1 },
-        { 141, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1,  -1,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1,  69,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 210, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1,  -1 },
-        { 293, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69,  69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 294, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69, 69,  69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69, 69, 212, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 295, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1,  -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1,  69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 296, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1,  -1 },
-        { 53, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 214,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 297, -1,  -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1,  -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1,  -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69,  69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69,  69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69,  69, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  298, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69,  69, 69, 299, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69, 69,  69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 216, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 300, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69,  69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 301, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69, 69,  69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69, 69, 218, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 141, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69,  69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 220, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 141, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 222, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69, -1, -1, -1, -1, -1 },
-        { 302, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 303, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 224, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69, -1, -1, -1, -1, -1 },
-        { 304, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1,  -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1,  -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 305, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1,  -1, -1, -1 },
-        { 53, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 226, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 306, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69,  69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69,  69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 307, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69,  69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69,  69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 228, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 308, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 309,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, 230, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
-        { 310, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 311, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1 },
-        { -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, 232, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
-        { 312, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, 313, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
-        { 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 235, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234 },
-        { 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 235, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234 },
-        { 314, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 315, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234 },
-        { -1, -1, -1, -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1, -1,
-          -1, -1, -1, -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1, -1,
-          -1, -1, -1, -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1, -1,
-          -1, -1, -1, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, -1, -1,
-          -1, -1, -1, -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1, -1,
-          -1, -1, -1, -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1, -1,
-          -1, -1, -1, -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1, -1,
-          -1, -1, -1, -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1, -1,
-          -1, -1, -1, -1,  -1,  -1,  -1,  -1 },
-        { 53, -1, -1, -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1, -1,
-          -1, -1, -1, -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1, -1,
-          -1, -1, -1, -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1, -1,
-          -1, -1, -1, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, -1, -1,
-          -1, -1, -1, -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1, -1,
-          -1, -1, -1, -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1, -1,
-          -1, -1, -1, -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1, -1,
-          -1, -1, -1, -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1, -1,
-          -1, -1, -1, -1,  -1,  -1,  -1,  -1 },
-        { 53, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69,  69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 239, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 316, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69,  -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69,  69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 317, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1,  -1, -1, -1,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1,  -1, -1, 69,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 241, 69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1,  -1, -1, -1 },
-        { 141, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69,  69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 243, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 318, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1,  -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1,  -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 319, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1,  -1, -1, -1, -1 },
-        { 53, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69,  69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 245, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 141, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1,  -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1,  -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1,  -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69,  69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69,  69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69,  69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 247, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69,  248, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 320, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69,  69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  321, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 322, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69,  -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69,  69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 323, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69,  69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69, 69, 69,  69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69,  69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69, 69, 69, 250, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69,  69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 141, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69, 69,  69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69, 69, 252, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 141, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 254, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 324, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69,  69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 325, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 256, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 326, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69,  69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 327, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 258, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 328, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 329, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69,  69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 260, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 330, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 331, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1,  -1, -1,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1,  -1, 69,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 262, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1,  -1, -1 },
-        { 141, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 264, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 141, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 266,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 332, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69,  69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69,  69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 333, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69, 69,  69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 268, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 334, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 335, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69,  69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 270, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 336, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69,  -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69,  69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 337, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69,  69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1,  -1,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1,  69,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 272, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1,  -1 },
-        { 141, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1,  -1, -1,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1,  -1, 69,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 274, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1,  -1, -1 },
-        { 338, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69,  69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  339, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          276, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 340, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69,  -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69,  69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 341, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 278, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 141, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1,  -1,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1,  69,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 280, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1,  -1 },
-        { 342, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 343, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69, 282, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 141, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69, 284, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 344, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 345,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69, 69,  69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 286, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 346, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69,  69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69,  69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 347, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 288, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 348, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69,  69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 349, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 290, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 141, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 292, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69, -1, -1, -1, -1, -1 },
-        { 350, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1,  -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1,  69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 351, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1,  -1 },
-        { 53, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 294, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 352, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 353,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1,  -1,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1,  69,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 296, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1,  -1 },
-        { 141, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1,  -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1,  -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1,  -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69,  69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69,  69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69,  69, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 298, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69,  69, 69, 299, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 354, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69,  69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69,  69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 355, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 356, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69,  69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 357, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69, 69,  69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69, 69, 301, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 358, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69, 303, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 141, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1,  -1, -1, -1,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1,  -1, -1, 69,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 305, 69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1,  -1, -1, -1 },
-        { 359, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69,  69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 360, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69, 69, 69, 69, 69,  69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69,  69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69, 69, 69, 69, 69, 307, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69,  69, 69, -1, -1, -1, -1, -1 },
-        { 141, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 309,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 361, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69,  69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 362, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 311, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1 },
-        { 363, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, 364, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
-        { -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, 313, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
-        { 365, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, 366, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
-        { 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 315, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234 },
-        { 367, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 368, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234 },
-        { 53, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 317, 69, -1, -1, -1, -1, -1 },
-        { 141, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1,  -1, -1, -1, -1,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1,  -1, -1, -1, 69,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 319, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1,  -1, -1, -1, -1 },
-        { 141, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69,  69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 321, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 369, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 370, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 323, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69, -1, -1, -1, -1, -1 },
-        { 371, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1,  -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1,  69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 372, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1,  -1 },
-        { 53, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69, 69,  69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69, 69, 325, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 358, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69, 69,  69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69, 69, 327, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 373, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69,  69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69,  69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 374, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 329, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 375, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69,  69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 376, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 331, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 141, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69,  69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 333, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 377, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 378, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 335, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 141, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 337, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69, -1, -1, -1, -1, -1 },
-        { 379, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69,  69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69,  69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 380, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69,  69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 339, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 381, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1,  -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1,  -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 382, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1,  -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 341, 69, -1, -1, -1, -1, -1 },
-        { 141, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 343, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 141, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 345,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 383, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69,  69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 384, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69,  69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69,  69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 347, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 385, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1,  -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1,  69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 386, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1,  -1 },
-        { 53, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69, 69,  69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69, 69, 349, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 141, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1,  -1,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1,  69,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 351, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1,  -1 },
-        { 387, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69,  69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69,  69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 388, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69,  69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 353,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 389, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69,  69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69,  69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 390, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69,  69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 355, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 391, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69,  69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69,  69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 392, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69, 69,  69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69, 69, 357, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 393, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1,  -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1,  69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 394, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1,  -1 },
-        { 53, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69, 69,  69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69, 69, 360, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 141, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 362, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 141, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, 364, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
-        { 395, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, 396, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
-        { -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, 366, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
-        { 397, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
-        { 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 368, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234 },
-        { 398, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 368, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234 },
-        { 53, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 370, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 141, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1,  -1,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1,  69,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 372, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1,  -1 },
-        { 399, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69,  69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 400, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69,  69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 374, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 141, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69, 69,  69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69, 69, 376, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 401, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1,  -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1,  69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 402, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1,  -1 },
-        { 53, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 378, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 141, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69, 69, 69, 69, 69,  69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69,  69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 380, 69, 69, -1, -1, -1, -1, -1 },
-        { 141, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1,  -1, -1, -1,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1,  -1, -1, 69,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 382, 69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1,  -1, -1, -1 },
-        { 403, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69,  -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69,  69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 404, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69,  69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 384, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 405, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69,  69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 406, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1,  -1,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1,  69,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 386, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1,  -1 },
-        { 141, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69, 69, 69, 69,  69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69,  69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69, 69, 69, 69, 388, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69,  69, 69, 69, -1, -1, -1, -1, -1 },
-        { 141, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69,  69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 390, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 141, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69,  69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 392, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 407, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69,  69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  408, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1,  -1,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1,  69,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 394, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1,  -1 },
-        { 409, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69,  69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 410, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, 396, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
-        { 397, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 },
-        { 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 368, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
-          234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234 },
-        { 53, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69, 69,  69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 400, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 411, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69,  69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 412, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1,  -1,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1,  69,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 402, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1,  -1 },
-        { 141, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 404, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69, -1, -1, -1, -1, -1 },
-        { 413, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1,  -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 414, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 406, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 415, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69,  69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69,  69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 416, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69,  69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 408, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 417, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69,  -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69,  69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 418, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69,  69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 410, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 419, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 420,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69, 69,  69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69, 69, 412, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 141, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1,  -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  -1, -1, -1, -1, 69,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 414, -1, -1, -1, -1, -1 },
-        { 421, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69,  69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 422, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69, 69, 69,  69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69,  69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69, 416, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 141, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 418, 69, -1, -1, -1, -1, -1 },
-        { 141, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 420,
-          69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 423, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69,  69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69,  69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 424, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1, -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69, 69, 69, 69,  69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69, 69, 69, 422, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69, 69, 69, 69,  69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 141, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 53, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1, -1, -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69, 69, 69,  69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1, 69, 69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69, 69, 424, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 },
-        { 141, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          -1,  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1, -1,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, 69,
-          -1,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
-          69,  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, -1, -1, -1, -1, -1 }
+const struct accel ACCEL[STATE_COUNT] = {
+        [1] = { .kind = ACCEL_RANGES, .count = 2,
+                .ranges = { { 0x09, 0x0D }, { ' ', ' ' } } },
+        [4] = { .kind = ACCEL_ESCAPES, .high = 1, .count = 1,
+                .escapes = { 0x0A } },
+        [14] = { .kind = ACCEL_RANGES, .count = 1, .ranges = { { '0', '9' } } },
+        [20] = { .kind = ACCEL_RANGES, .count = 4,
+                .ranges = { { '0', '9' }, { 'A', 'Z' }, { '_', '_' }, { 'a', 'z' } } },
+        [44] = { .kind = ACCEL_ESCAPES, .high = 1, .count = 2,
+                .escapes = { 0x0A, '\"' } },
+        [97] = { .kind = ACCEL_ESCAPES, .high = 1, .count = 1,
+                .escapes = { '\"' } },
+        [99] = { .kind = ACCEL_RANGES, .count = 1, .ranges = { { '0', '9' } } },
+        [207] = { .kind = ACCEL_RANGES, .count = 1, .ranges = { { '\"', '\"' } } },
 };
 
+/* whether c keeps a ranges accelerator in its state */
+static int accel_in_ranges(const struct accel *a, unsigned char c)
+{
+        for (int i = 0; i < a->count; i++) {
+                if (c >= a->ranges[i][0] && c <= a->ranges[i][1])
+                        return 1;
+        }
+        return 0;
+}
+
+static const unsigned char *accel_skip_scalar(const unsigned char *p,
+                                              const unsigned char *end,
+                                              const struct accel *a)
+{
+        if (a->kind == ACCEL_RANGES) {
+                while (p < end && accel_in_ranges(a, *p))
+                        p++;
+                return p;
+        }
+
+        for (; p < end; p++) {
+                if (a->high && *p >= 0x80)
+                        return p;
+                for (int i = 0; i < a->count; i++) {
+                        if (*p == a->escapes[i])
+                                return p;
+                }
+        }
+        return end;
+}
+
+#ifdef __SSE2__
+/*
+ * stop bytes are marked in the returned mask. a byte c lies in [lo, hi]
+ * exactly when c - lo <= hi - lo as unsigned bytes, which SSE2 can test
+ * with max_epu8, and the sign bit of every byte is set exactly for >= 0x80
+ */
+static const unsigned char *accel_skip_sse2(const unsigned char *p,
+                                            const unsigned char *end,
+                                            const struct accel *a)
+{
+        __m128i lo[ACCEL_MAX_RANGES], width[ACCEL_MAX_RANGES];
+        for (int i = 0; i < a->count; i++) {
+                if (a->kind == ACCEL_RANGES) {
+                        lo[i] = _mm_set1_epi8((char)a->ranges[i][0]);
+                        width[i] = _mm_set1_epi8(
+                            (char)(a->ranges[i][1] - a->ranges[i][0]));
+                } else {
+                        lo[i] = _mm_set1_epi8((char)a->escapes[i]);
+                }
+        }
+
+        for (; end - p >= 16; p += 16) {
+                __m128i chunk = _mm_loadu_si128((const __m128i *)p);
+                int mask;
+                if (a->kind == ACCEL_RANGES) {
+                        __m128i in = _mm_setzero_si128();
+                        for (int i = 0; i < a->count; i++) {
+                                __m128i offset = _mm_sub_epi8(chunk, lo[i]);
+                                in = _mm_or_si128(
+                                    in,
+                                    _mm_cmpeq_epi8(
+                                        _mm_max_epu8(offset, width[i]),
+                                        width[i]));
+                        }
+                        mask = ~_mm_movemask_epi8(in) & 0xFFFF;
+                } else {
+                        mask = a->high ? _mm_movemask_epi8(chunk) : 0;
+                        for (int i = 0; i < a->count; i++)
+                                mask |= _mm_movemask_epi8(
+                                    _mm_cmpeq_epi8(chunk, lo[i]));
+                }
+                if (mask)
+                        return p + __builtin_ctz(mask);
+        }
+
+        return accel_skip_scalar(p, end, a);
+}
+#endif
+
+#ifdef ACCEL_HAVE_AVX2
+/* accel_skip_sse2() 32 bytes at a time, only called when the cpu has avx2 */
+__attribute__((target("avx2"))) static const unsigned char *
+accel_skip_avx2(const unsigned char *p,
+                const unsigned char *end,
+                const struct accel *a)
+{
+        __m256i lo[ACCEL_MAX_RANGES], width[ACCEL_MAX_RANGES];
+        for (int i = 0; i < a->count; i++) {
+                if (a->kind == ACCEL_RANGES) {
+                        lo[i] = _mm256_set1_epi8((char)a->ranges[i][0]);
+                        width[i] = _mm256_set1_epi8(
+                            (char)(a->ranges[i][1] - a->ranges[i][0]));
+                } else {
+                        lo[i] = _mm256_set1_epi8((char)a->escapes[i]);
+                }
+        }
+
+        for (; end - p >= 32; p += 32) {
+                __m256i chunk = _mm256_loadu_si256((const __m256i *)p);
+                unsigned mask;
+                if (a->kind == ACCEL_RANGES) {
+                        __m256i in = _mm256_setzero_si256();
+                        for (int i = 0; i < a->count; i++) {
+                                __m256i offset =
+                                    _mm256_sub_epi8(chunk, lo[i]);
+                                in = _mm256_or_si256(
+                                    in,
+                                    _mm256_cmpeq_epi8(
+                                        _mm256_max_epu8(offset, width[i]),
+                                        width[i]));
+                        }
+                        mask = ~(unsigned)_mm256_movemask_epi8(in);
+                } else {
+                        mask = a->high ? (unsigned)_mm256_movemask_epi8(chunk)
+                                       : 0;
+                        for (int i = 0; i < a->count; i++)
+                                mask |= (unsigned)_mm256_movemask_epi8(
+                                    _mm256_cmpeq_epi8(chunk, lo[i]));
+                }
+                if (mask)
+                        return p + __builtin_ctz(mask);
+        }
+
+        return accel_skip_sse2(p, end, a);
+}
+#endif
+
+const unsigned char *accel_skip(const unsigned char *p,
+                                const unsigned char *end,
+                                const struct accel *a)
+{
+        if (a->kind == ACCEL_ESCAPES && !a->high && a->count == 1) {
+                const unsigned char *hit = memchr(p, a->escapes[0], end - p);
+                return hit ? hit : end;
+        }
+
+#ifdef ACCEL_HAVE_AVX2
+        // reads what libgcc found before main, so threads can share it
+        if (__builtin_cpu_supports("avx2"))
+                return accel_skip_avx2(p, end, a);
+#endif
+#ifdef __SSE2__
+        return accel_skip_sse2(p, end, a);
+#else
+        return accel_skip_scalar(p, end, a);
+#endif
+}
+
 char *tok_type_to_str(TokenType type)
 {
         switch (type) {
-                case AND:
-                        return "AND";
-                case ARRAY_TOK:
-                        return "ARRAY_TOK";
-                case ASSIGN:
-                        return "ASSIGN";
-                case ASTERISK:
-                        return "ASTERISK";
-                case AS_TOK:
-                        return "AS_TOK";
-                case BOOL_LITERAL:
-                        return "BOOL_LITERAL";
-                case BOOL_TOK:
-                        return "BOOL_TOK";
-                case BREAK_TOK:
-                        return "BREAK_TOK";
-                case CHAR_LITERAL:
-                        return "CHAR_LITERAL";
-                case CHAR_TOK:
-                        return "CHAR_TOK";
-                case COLON:
-                        return "COLON";
-                case COMMA:
-                        return "COMMA";
-                case COMMENT:
-                        return "COMMENT";
-                case CONCAT_TOK:
-                        return "CONCAT_TOK";
-                case CONTINUE_TOK:
-                        return "CONTINUE_TOK";
-                case DO:
-                        return "DO";
-                case DOT_TOK:
-                        return "DOT_TOK";
-                case DOUBLE_ASTERISK:
-                        return "DOUBLE_ASTERISK";
-                case DOUBLE_SLASH:
-                        return "DOUBLE_SLASH";
-                case ELIF_TOK:
-                        return "ELIF_TOK";
-                case ELSE_TOK:
-                        return "ELSE_TOK";
-                case END:
-                        return "END";
-                case EQUAL:
-                        return "EQUAL";
-                case FILTER_TOK:
-                        return "FILTER_TOK";
-                case FLATTEN_TOK:
-                        return "FLATTEN_TOK";
-                case FLOAT_LITERAL:
-                        return "FLOAT_LITERAL";
-                case FLOAT_TOK:
-                        return "FLOAT_TOK";
-                case FOR_TOK:
-                        return "FOR_TOK";
-                case FROM_TOK:
-                        return "FROM_TOK";
-                case FUNC_TOK:
-                        return "FUNC_TOK";
-                case GREATER_EQUAL:
-                        return "GREATER_EQUAL";
-                case GREATER_THAN:
-                        return "GREATER_THAN";
-                case IDENTIFIER:
-                        return "IDENTIFIER";
-                case IF_TOK:
-                        return "IF_TOK";
-                case IMPORT_TOK:
-                        return "IMPORT_TOK";
-                case INPUT_TOK:
-                        return "INPUT_TOK";
-                case INT_LITERAL:
-                        return "INT_LITERAL";
-                case INT_TOK:
-                        return "INT_TOK";
-                case IN_TOK:
-                        return "IN_TOK";
-                case LEFT_CURLY_BRACE:
-                        return "LEFT_CURLY_BRACE";
-                case LEFT_PARENTHESIS:
-                        return "LEFT_PARENTHESIS";
-                case LEFT_SQUARE_BRACKET:
-                        return "LEFT_SQUARE_BRACKET";
-                case LESS_EQUAL:
-                        return "LESS_EQUAL";
-                case LESS_THAN:
-                        return "LESS_THAN";
-                case MATRIX_TOK:
-                        return "MATRIX_TOK";
-                case MAX_TOK:
-                        return "MAX_TOK";
-                case MEAN_TOK:
-                        return "MEAN_TOK";
-                case MINUS:
-                        return "MINUS";
-                case MIN_TOK:
-                        return "MIN_TOK";
-                case MODULO:
-                        return "MODULO";
-                case MULTILINE_COMMENT:
-                        return "MULTILINE_COMMENT";
-                case NORMALIZE_TOK:
-                        return "NORMALIZE_TOK";
-                case NOT:
-                        return "NOT";
-                case NOT_EQUAL:
-                        return "NOT_EQUAL";
-                case NUMPY_TOK:
-                        return "NUMPY_TOK";
-                case ONES_TOK:
-                        return "ONES_TOK";
-                case OR:
-                        return "OR";
-                case PLUS:
-                        return "PLUS";
-                case PRINT_TOK:
-                        return "PRINT_TOK";
-                case RAND_TOK:
-                        return "RAND_TOK";
-                case READCSV_TOK:
-                        return "READCSV_TOK";
-                case RETURN_TOK:
-                        return "RETURN_TOK";
-                case RIGHT_CURLY_BRACE:
-                        return "RIGHT_CURLY_BRACE";
-                case RIGHT_PARENTHESIS:
-                        return "RIGHT_PARENTHESIS";
-                case RIGHT_SQUARE_BRACKET:
-                        return "RIGHT_SQUARE_BRACKET";
-                case SEMI_COLON:
-                        return "SEMI_COLON";
-                case SLASH:
-                        return "SLASH";
-                case SLICE_TOK:
-                        return "SLICE_TOK";
-                case SORT_TOK:
-                        return "SORT_TOK";
-                case STD_TOK:
-                        return "STD_TOK";
-                case STRING_LITERAL:
-                        return "STRING_LITERAL";
-                case STRING_TOK:
-                        return "STRING_TOK";
-                case SUM_TOK:
-                        return "SUM_TOK";
-                case TENSOR_TOK:
-                        return "TENSOR_TOK";
-                case THEN:
-                        return "THEN";
-                case TOARRAY_TOK:
-                        return "TOARRAY_TOK";
-                case TOTENSOR_TOK:
-                        return "TOTENSOR_TOK";
-                case USE_TOK:
-                        return "USE_TOK";
-                case VAR_TOK:
-                        return "VAR_TOK";
-                case VOID_TOK:
-                        return "VOID_TOK";
-                case WHILE_TOK:
-                        return "WHILE_TOK";
-                case WHITESPACE:
-                        return "WHITESPACE";
-                case WITH_TOK:
-                        return "WITH_TOK";
-                case ZEROS_TOK:
-                        return "ZEROS_TOK";
-                case UNKNOWN:
-                        return "UNKNOWN";
-                default:
-                        return "UNKNOWN";
+        case AND:
+                return "AND";
+        case ARRAY_TOK:
+                return "ARRAY_TOK";
+        case ASSIGN:
+                return "ASSIGN";
+        case ASTERISK:
+                return "ASTERISK";
+        case AS_TOK:
+                return "AS_TOK";
+        case BOOL_LITERAL:
+                return "BOOL_LITERAL";
+        case BOOL_TOK:
+                return "BOOL_TOK";
+        case BREAK_TOK:
+                return "BREAK_TOK";
+        case CHAR_LITERAL:
+                return "CHAR_LITERAL";
+        case CHAR_TOK:
+                return "CHAR_TOK";
+        case COLON:
+                return "COLON";
+        case COMMA:
+                return "COMMA";
+        case COMMENT:
+                return "COMMENT";
+        case CONCAT_TOK:
+                return "CONCAT_TOK";
+        case CONTINUE_TOK:
+                return "CONTINUE_TOK";
+        case DO:
+                return "DO";
+        case DOT_TOK:
+                return "DOT_TOK";
+        case DOUBLE_ASTERISK:
+                return "DOUBLE_ASTERISK";
+        case DOUBLE_SLASH:
+                return "DOUBLE_SLASH";
+        case ELIF_TOK:
+                return "ELIF_TOK";
+        case ELSE_TOK:
+                return "ELSE_TOK";
+        case END:
+                return "END";
+        case EQUAL:
+                return "EQUAL";
+        case FILTER_TOK:
+                return "FILTER_TOK";
+        case FLATTEN_TOK:
+                return "FLATTEN_TOK";
+        case FLOAT_LITERAL:
+                return "FLOAT_LITERAL";
+        case FLOAT_TOK:
+                return "FLOAT_TOK";
+        case FOR_TOK:
+                return "FOR_TOK";
+        case FROM_TOK:
+                return "FROM_TOK";
+        case FUNC_TOK:
+                return "FUNC_TOK";
+        case GREATER_EQUAL:
+                return "GREATER_EQUAL";
+        case GREATER_THAN:
+                return "GREATER_THAN";
+        case IDENTIFIER:
+                return "IDENTIFIER";
+        case IF_TOK:
+                return "IF_TOK";
+        case IMPORT_TOK:
+                return "IMPORT_TOK";
+        case INPUT_TOK:
+                return "INPUT_TOK";
+        case INT_LITERAL:
+                return "INT_LITERAL";
+        case INT_TOK:
+                return "INT_TOK";
+        case IN_TOK:
+                return "IN_TOK";
+        case LEFT_CURLY_BRACE:
+                return "LEFT_CURLY_BRACE";
+        case LEFT_PARENTHESIS:
+                return "LEFT_PARENTHESIS";
+        case LEFT_SQUARE_BRACKET:
+                return "LEFT_SQUARE_BRACKET";
+        case LESS_EQUAL:
+                return "LESS_EQUAL";
+        case LESS_THAN:
+                return "LESS_THAN";
+        case MATRIX_TOK:
+                return "MATRIX_TOK";
+        case MAX_TOK:
+                return "MAX_TOK";
+        case MEAN_TOK:
+                return "MEAN_TOK";
+        case MINUS:
+                return "MINUS";
+        case MIN_TOK:
+                return "MIN_TOK";
+        case MODULO:
+                return "MODULO";
+        case MULTILINE_COMMENT:
+                return "MULTILINE_COMMENT";
+        case NORMALIZE_TOK:
+                return "NORMALIZE_TOK";
+        case NOT:
+                return "NOT";
+        case NOT_EQUAL:
+                return "NOT_EQUAL";
+        case NUMPY_TOK:
+                return "NUMPY_TOK";
+        case ONES_TOK:
+                return "ONES_TOK";
+        case OR:
+                return "OR";
+        case PLUS:
+                return "PLUS";
+        case PRINT_TOK:
+                return "PRINT_TOK";
+        case RAND_TOK:
+                return "RAND_TOK";
+        case READCSV_TOK:
+                return "READCSV_TOK";
+        case RETURN_TOK:
+                return "RETURN_TOK";
+        case RIGHT_CURLY_BRACE:
+                return "RIGHT_CURLY_BRACE";
+        case RIGHT_PARENTHESIS:
+                return "RIGHT_PARENTHESIS";
+        case RIGHT_SQUARE_BRACKET:
+                return "RIGHT_SQUARE_BRACKET";
+        case SEMI_COLON:
+                return "SEMI_COLON";
+        case SLASH:
+                return "SLASH";
+        case SLICE_TOK:
+                return "SLICE_TOK";
+        case SORT_TOK:
+                return "SORT_TOK";
+        case STD_TOK:
+                return "STD_TOK";
+        case STRING_LITERAL:
+                return "STRING_LITERAL";
+        case STRING_TOK:
+                return "STRING_TOK";
+        case SUM_TOK:
+                return "SUM_TOK";
+        case TENSOR_TOK:
+                return "TENSOR_TOK";
+        case THEN:
+                return "THEN";
+        case TOARRAY_TOK:
+                return "TOARRAY_TOK";
+        case TOTENSOR_TOK:
+                return "TOTENSOR_TOK";
+        case USE_TOK:
+                return "USE_TOK";
+        case VAR_TOK:
+                return "VAR_TOK";
+        case VOID_TOK:
+                return "VOID_TOK";
+        case WHILE_TOK:
+                return "WHILE_TOK";
+        case WHITESPACE:
+                return "WHITESPACE";
+        case WITH_TOK:
+                return "WITH_TOK";
+        case ZEROS_TOK:
+                return "ZEROS_TOK";
+        case UNKNOWN:
+                return "UNKNOWN";
+        default:
+                return "UNKNOWN";
         }
 }
 
 const int ACCEPT_STATE_IDS[STATE_COUNT] = {
-        0, 0, 1, 0, 0, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        0, 1, 0, 0, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
         1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 0, 1,
-        0, 0, 1, 1, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 1, 0, 1, 0, 1, 1, 1, 1, 1,
-        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 1, 1, 1, 1,
-        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1,
+        1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
         1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
         1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
-        0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1,
         1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-        1, 1, 1, 0, 0, 0, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1,
-        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
 };
 
 const int STATE_TOKEN_TYPE[STATE_COUNT] = {
-        -1, -1, 0,  -1, -1, 1,  2,  -1, 3,  4,  5,  6,  7,  8,  9,  10, 11, 12,
-        13, 14, 15, 16, 17, 18, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
-        16, 16, 16, 16, 16, 16, 19, 20, -1, 0,  -1, 21, -1, -1, 22, 1,  1,  -1,
-        -1, -1, -1, 23, -1, 24, 10, -1, -1, 25, -1, 26, -1, 27, 16, 16, 16, 16,
-        16, 28, 16, 16, 16, 16, 16, 16, 16, 29, 16, 16, 16, 16, 16, 16, 16, 16,
-        16, 16, 16, 30, 16, 31, 16, 16, 16, 16, 16, 16, 16, 16, 16, 32, 16, 16,
-        16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
-        16, 16, 16, 16, 16, -1, -1, 22, -1, -1, 33, -1, -1, -1, 34, 16, 16, 35,
-        16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 36, 16, 16, 16, 16, 37, 16,
-        16, 16, 16, 16, 16, 16, 16, 38, 16, 16, 16, 16, 16, 16, 16, 16, 39, 16,
-        16, 40, 16, 16, 16, 41, 16, 16, 42, 16, 16, 16, 16, 16, 16, 16, 16, 16,
-        16, 16, 16, 16, 16, 16, 16, 43, 16, 16, 44, 16, 16, 16, 16, 16, 16, 16,
-        16, 16, 45, 16, 46, 16, 16, 16, 16, 16, 16, 16, 16, -1, -1, -1, -1, -1,
-        -1, -1, -1, 34, 16, 16, 16, 47, 16, 16, 16, 48, 16, 16, 16, 16, 49, 16,
-        50, 16, 16, 16, 16, 16, 16, 16, 16, 16, 51, 16, 52, 16, 16, 16, 16, 16,
-        16, 16, 53, 16, 16, 16, 16, 16, 54, 16, 16, 16, 55, 16, 16, 16, 16, 16,
-        16, 16, 56, 16, 16, 16, 16, 16, 57, 16, 16, 16, 16, 58, 16, 59, 16, 16,
-        16, 60, 16, 16, -1, -1, -1, -1, -1, -1, 16, 61, 16, 62, 16, 16, 16, 16,
-        16, 58, 16, 16, 16, 16, 16, 63, 16, 16, 16, 64, 16, 16, 16, 16, 16, 65,
-        16, 66, 16, 16, 16, 16, 16, 67, 16, 16, 16, 16, 16, 16, 16, 16, 58, 16,
-        68, 16, 69, -1, -1, -1, 58, -1, 70, 16, 71, 16, 16, 16, 72, 16, 16, 16,
-        73, 16, 74, 16, 16, 16, 16, 16, 75, 16, 76, 16, 77, 16, 16, 16, 16, -1,
-        58, 58, -1, 16, 16, 16, 78, 16, 16, 16, 16, 16, 16, 16, 16, 16, 79, 16,
-        16, 16, 80, 16, 81, 16, 16, 16, 82, 16, 83
+        -1, 0, -1, -1, 1, 2, -1, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+        16, 17, 18, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 19, 20, 21, -1, 22, -1, 23, 24, -1, 25, 26, 27, 16, 16, 28,
+        16, 16, 16, 16, 29, 16, 16, 16, 16, 16, 16, 16, 16, 30, 16, 31, 16, 16,
+        16, 16, 16, 16, 32, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 22, -1, 33, 34, 35, 16, 16, 16, 16, 16, 36, 16, 16, 37,
+        16, 16, 16, 16, 38, 16, 16, 16, 16, 39, 16, 40, 16, 41, 16, 42, 16, 16,
+        16, 16, 16, 16, 16, 16, 43, 16, 44, 16, 16, 16, 16, 45, 46, 16, 16, 16,
+        16, -1, 16, 47, 16, 48, 16, 16, 49, 50, 16, 16, 16, 51, 52, 16, 16, 16,
+        53, 16, 16, 54, 16, 55, 16, 16, 16, 56, 16, 16, 57, 16, 16, 58, 59, 16,
+        60, 16, -1, 61, 62, 16, 16, 16, 16, 63, 16, 64, 16, 16, 65, 66, 16, 16,
+        67, 16, 16, 16, 16, 68, 69, 70, 71, 16, 72, 16, 73, 74, 16, 16, 75, 76,
+        77, 16, 16, 16, 78, 16, 16, 16, 16, 79, 16, 80, 81, 16, 82, 83
 };
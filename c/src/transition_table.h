@@ -2,13 +2,57 @@
 #define TRANSITION_TABLE_H
 
 #include <limits.h>
+#include <stddef.h>
+#include <stdint.h>
 
-#define STATE_COUNT 425
-#define SYMBOL_COUNT 128
+#define STATE_COUNT 234
+#define SYMBOL_COUNT 53
+
+typedef uint8_t state_id_t;
+#define NO_STATE 255
 
 extern const char ALPHABET[SYMBOL_COUNT];
-extern const int SYMBOL_TO_ID[256];
-extern const int TRANSITION_TABLE[STATE_COUNT][SYMBOL_COUNT];
+extern const unsigned char SYMBOL_TO_ID[256];
+
+#define ACCEL_MAX_ESCAPES 3
+#define ACCEL_MAX_RANGES 4
+#define ACCEL_MIN_RUN 4
+
+enum { ACCEL_NONE, ACCEL_ESCAPES, ACCEL_RANGES };
+
+/*
+ * skip accelerator of a state that goes back to itself on most bytes, zero
+ * for other states. an ACCEL_ESCAPES state loops on every byte except its
+ * escapes, like the inside of a comment. an ACCEL_RANGES state loops on the
+ * bytes in its ranges, like the rest of an identifier
+ */
+struct accel {
+        unsigned char kind;
+        unsigned char high; /* every byte >= 0x80 escapes as well */
+        unsigned char count; /* escapes or ranges */
+        unsigned char escapes[ACCEL_MAX_ESCAPES];
+        unsigned char ranges[ACCEL_MAX_RANGES][2]; /* inclusive */
+};
+
+extern const struct accel ACCEL[STATE_COUNT];
+
+/*
+ * first byte in [p, end) that leaves the state of a, end if there is none.
+ * uses avx2 when the cpu has it, sse2 or a scalar loop if not
+ */
+const unsigned char *accel_skip(const unsigned char *p,
+                                const unsigned char *end,
+                                const struct accel *a);
+
+#define TABLE_ENCODING_DENSE
+
+extern const state_id_t TRANSITION_TABLE[STATE_COUNT][SYMBOL_COUNT];
+
+/* next state on column cls, NO_STATE if there is none */
+static inline int table_next(int state, int cls)
+{
+        return TRANSITION_TABLE[state][cls];
+}
 
 #define START_STATE_ID 0
 
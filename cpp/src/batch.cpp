@@ -0,0 +1,233 @@
+#include "./batch.hpp"
+#include "./source_buffer.hpp"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
+// bytes a worker buffers per output before copying them out
+static constexpr size_t FLUSH_SIZE = 1024 * 1024;
+
+static bool collectDirectory(const std::filesystem::path &dir,
+                             std::vector<std::string> &sources)
+{
+  namespace fs = std::filesystem;
+
+  std::error_code error;
+  // links to directories are not followed, they could lead back up the tree
+  fs::recursive_directory_iterator it(dir, error), end;
+  for (; !error && it != end; it.increment(error)) {
+    // skips hidden entries like .git, along with everything under them
+    if (it->path().filename().string().front() == '.') {
+      it.disable_recursion_pending();
+      continue;
+    }
+
+    std::error_code statusError;
+    if (it->path().extension() == ".ai" && it->is_regular_file(statusError))
+      sources.push_back(it->path().string());
+  }
+  if (error)
+    return false;
+
+  std::sort(sources.begin(), sources.end());
+  return true;
+}
+
+static bool collectList(std::istream &list, std::vector<std::string> &sources)
+{
+  std::string line;
+  while (std::getline(list, line)) {
+    if (!line.empty() && line.back() == '\r')
+      line.pop_back();
+    if (!line.empty())
+      sources.push_back(line);
+  }
+  return !list.bad();
+}
+
+bool collectSources(const std::string &path, std::vector<std::string> &sources)
+{
+  sources.clear();
+  if (path == "-")
+    return collectList(std::cin, sources);
+
+  std::error_code error;
+  if (std::filesystem::is_directory(path, error))
+    return collectDirectory(path, sources);
+
+  std::ifstream list(path);
+  return list && collectList(list, sources);
+}
+
+namespace
+{
+// sources a worker has yet to take, [next, end)
+struct Share {
+  std::mutex lock;
+  size_t next = 0;
+  size_t end = 0;
+};
+
+// output a worker has not copied out yet
+struct Output {
+  std::ostream &stream;
+  std::string buffer;
+
+  explicit Output(std::ostream &out) : stream(out) {}
+};
+
+class Batch
+{
+private:
+  const std::vector<std::string> &sources;
+  const MakeBatchLexer &makeLexer;
+  const BatchLex &lex;
+
+  std::vector<Share> shares;
+  std::mutex outputLock;
+  Output symbols;
+  Output errors;
+
+  bool take(unsigned id, size_t &index);
+  void flush(Output &worker, Output &shared, size_t least);
+
+public:
+  Batch(const std::vector<std::string> &paths,
+        unsigned workers,
+        const MakeBatchLexer &make,
+        const BatchLex &lexSource,
+        std::ostream &symbolsOut,
+        std::ostream &errorsOut)
+      : sources(paths), makeLexer(make), lex(lexSource), shares(workers),
+        symbols(symbolsOut), errors(errorsOut)
+  {
+    for (unsigned i = 0; i < workers; i++) {
+      shares[i].next = paths.size() * i / workers;
+      shares[i].end = paths.size() * (i + 1) / workers;
+    }
+  }
+
+  // runs worker id until every share is empty, returns its failures
+  size_t work(unsigned id);
+};
+} // namespace
+
+// takes the next source of the worker's share, or steals half of what is
+// left of the first other share that has any. false when all are empty
+bool Batch::take(unsigned id, size_t &index)
+{
+  Share &own = shares[id];
+  {
+    std::lock_guard<std::mutex> guard(own.lock);
+    if (own.next < own.end) {
+      index = own.next++;
+      return true;
+    }
+  }
+
+  for (unsigned i = 1; i < shares.size(); i++) {
+    Share &victim = shares[(id + i) % shares.size()];
+
+    // the back half, which its owner reaches last
+    size_t stolen, begin;
+    {
+      std::lock_guard<std::mutex> guard(victim.lock);
+      stolen = (victim.end - victim.next + 1) / 2;
+      victim.end -= stolen;
+      begin = victim.end;
+    }
+    if (stolen == 0)
+      continue;
+
+    std::lock_guard<std::mutex> guard(own.lock);
+    own.next = begin + 1;
+    own.end = begin + stolen;
+    index = begin;
+    return true;
+  }
+  return false;
+}
+
+// copies worker to shared and empties it once it holds at least least bytes
+void Batch::flush(Output &worker, Output &shared, size_t least)
+{
+  if (worker.buffer.size() < least)
+    return;
+
+  {
+    std::lock_guard<std::mutex> guard(outputLock);
+    shared.stream.write(worker.buffer.data(), worker.buffer.size());
+  }
+  worker.buffer.clear();
+}
+
+size_t Batch::work(unsigned id)
+{
+  TableDrivenLexer lexer = makeLexer(id);
+  Output workerSymbols(symbols.stream);
+  Output workerErrors(errors.stream);
+  std::ostringstream table;
+  std::ostringstream messages;
+  lexer.setErrors(messages);
+  size_t failed = 0;
+
+  size_t index;
+  while (take(id, index)) {
+    const std::string &path = sources[index];
+    table.str("");
+    messages.str("");
+
+    SourceBuffer source;
+    if (source.load(path)) {
+      lex(lexer, source.view());
+      table << "==> " << path << " <==\n";
+      lexer.writeSymbolTable(table);
+      workerSymbols.buffer += table.view();
+    } else {
+      messages << "could not read the source file\n";
+      failed++;
+    }
+
+    // every line of the source's errors is prefixed with its path
+    std::istringstream lines(messages.str());
+    std::string line;
+    while (std::getline(lines, line))
+      workerErrors.buffer.append(path).append(": ").append(line) += '\n';
+
+    flush(workerSymbols, symbols, FLUSH_SIZE);
+    flush(workerErrors, errors, FLUSH_SIZE);
+  }
+
+  flush(workerSymbols, symbols, 0);
+  flush(workerErrors, errors, 0);
+  return failed;
+}
+
+size_t lexBatch(const std::vector<std::string> &sources,
+                unsigned workers,
+                const MakeBatchLexer &makeLexer,
+                const BatchLex &lex,
+                std::ostream &symbols,
+                std::ostream &errors)
+{
+  workers = std::max<size_t>(std::min<size_t>(workers, sources.size()), 1);
+  Batch batch(sources, workers, makeLexer, lex, symbols, errors);
+
+  // the calling thread is worker 0
+  std::vector<size_t> failed(workers);
+  std::vector<std::thread> pool;
+  for (unsigned id = 1; id < workers; id++)
+    pool.emplace_back([&, id] { failed[id] = batch.work(id); });
+  failed[0] = batch.work(0);
+  for (std::thread &thread : pool)
+    thread.join();
+
+  size_t total = 0;
+  for (size_t count : failed)
+    total += count;
+  return total;
+}
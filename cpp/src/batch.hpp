@@ -0,0 +1,42 @@
+#ifndef BATCH_HPP
+#define BATCH_HPP
+
+#include <functional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "./lexer.hpp"
+
+// the sources named by path: every .ai file under it, recursively, if it is
+// a directory, and otherwise each non-empty line of the list file it names,
+// or of stdin if path is "-". hidden directory entries are skipped and the
+// rest are sorted. false if path or a directory under it can't be read
+bool collectSources(const std::string &path, std::vector<std::string> &sources);
+
+// makes the lexer of worker id, for id in [0, workers)
+using MakeBatchLexer = std::function<TableDrivenLexer(unsigned id)>;
+// lexes input with a lexer made by MakeBatchLexer, lexer.lex() for the
+// lexers that have a table
+using BatchLex = std::function<void(TableDrivenLexer &, std::string_view)>;
+
+// lexes every source on up to workers threads, each with a lexer of its
+// own. the automata the lexers are made from are shared, so they must be
+// safe to read from several threads, which all but a LazyDFA are.
+//
+// each worker starts with an even share of the sources and, once its share
+// runs out, steals half of what another worker has left. its symbol tables
+// and errors go to buffers of its own, and only a full buffer is copied to
+// symbols or errors. the symbol table of a source is headed by
+// "==> path <==" and never split up, but sources appear in the order they
+// finish. each error line starts with the path of its source.
+//
+// returns the number of sources that could not be read
+size_t lexBatch(const std::vector<std::string> &sources,
+                unsigned workers,
+                const MakeBatchLexer &makeLexer,
+                const BatchLex &lex,
+                std::ostream &symbols,
+                std::ostream &errors);
+
+#endif
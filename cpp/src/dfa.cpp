@@ -1,19 +1,26 @@
+#include <algorithm>
+#include <cstring>
 #include <fstream>
 #include <iostream>
 #include <queue>
 #include <stdexcept>
 #include "./dfa.hpp"
+#include "./followpos.hpp"
 
-DFAState *DFA::createState(const std::set<NFAState *> &nfaStates)
+#ifdef __SSE2__
+#include <immintrin.h>
+#endif
+
+DFAState *DFA::createState()
 {
   int id = states.size();
-  auto state = std::make_unique<DFAState>(id, nfaStates);
+  auto state = std::make_unique<DFAState>(id);
   DFAState *ptr = state.get();
   states.push_back(std::move(state));
   return ptr;
 }
 
-void DFA::addTransition(DFAState *f, DFAState *t, char symb)
+void DFA::addTransition(DFAState *f, DFAState *t, int symb)
 {
   transitions.emplace_back(f, t, symb);
 }
@@ -30,8 +37,9 @@ std::vector<DFATransition *> DFA::getTransitions(DFAState *state)
 
 DFAState *DFA::getNextState(DFAState *state, char symb)
 {
+  int symbol = classes.classOf[static_cast<unsigned char>(symb)];
   for (auto &trans : transitions) {
-    if (trans.from == state && trans.symbol == symb)
+    if (trans.from == state && trans.symbol == symbol)
       return trans.to;
   }
   return nullptr;
@@ -52,6 +60,28 @@ MatchResult DFA::matches(const std::string &input)
            currentState->isAccept ? currentState->tokenType : std::nullopt };
 }
 
+DFAState *SubsetConstruction::createDFAState(StateSet &&nfaStates)
+{
+  DFAState *state = dfa.createState();
+  auto it = stateMapping.emplace(std::move(nfaStates), state).first;
+  dfaStateSets.push_back(&it->first);
+
+  // Check for accept states and token types in the set
+  NFAState *accepting = nfa.acceptingState(it->first);
+  if (accepting) {
+    state->isAccept = true;
+    dfa.acceptStates.insert(state);
+  }
+
+  if (accepting && accepting->tokenType) {
+    state->tokenType = accepting->tokenType;
+    std::cout << "Setting token type for DFA state " << state->id << ": "
+              << *state->tokenType << std::endl;
+  }
+
+  return state;
+}
+
 DFA SubsetConstruction::convert()
 {
   std::cout << "Starting subset construction..." << std::endl;
@@ -60,88 +90,41 @@ DFA SubsetConstruction::convert()
     throw std::runtime_error("NFA has no start states");
   }
 
-  std::set<char> alphabet = nfa.getAlphabet();
-  std::cout << "Alphabet size: " << alphabet.size() << std::endl;
+  dfa.classes = classes;
+  std::cout << "Byte classes: " << classes.count() << std::endl;
 
-  std::set<NFAState *> nfaStartStates = { nfa.startState };
-  std::set<NFAState *> startClosure = nfa.epsilonClosure(nfaStartStates);
+  StateSet startClosure(nfa.stateCount());
+  startClosure.insert(nfa.startState->id);
+  nfa.epsilonClosure(startClosure);
 
-  DFAState *dfaStartState = dfa.createState(startClosure);
-  dfa.startState = dfaStartState;
-  stateMapping[startClosure] = dfaStartState;
+  dfa.startState = createDFAState(std::move(startClosure));
 
-  // Check for accept states and token types in the closre
-  int bestPriority = INT_MAX;
-  std::optional<std::string> bestTokenType = std::nullopt;
-
-  for (NFAState *nfaState : startClosure) {
-    if (nfaState->isAccept) {
-      dfaStartState->isAccept = true;
-      if (nfaState->tokenType && nfaState->tokenPriority < bestPriority) {
-        // dfaStartState->tokenType = nfaState->tokenType
-        bestTokenType = nfaState->tokenType;
-        bestPriority = nfaState->tokenPriority;
-      }
-      dfa.acceptStates.insert(dfaStartState);
-    }
-  }
-
-  if (bestTokenType) {
-    dfaStartState->tokenType = bestTokenType;
-    std::cout << "Setting token type for start DFA state " << dfaStartState->id
-              << ": " << *bestTokenType << std::endl;
-  }
-
-  std::queue<std::set<NFAState *>> workQueue;
-  workQueue.push(startClosure);
-  std::set<std::set<NFAState *>> processed;
+  // every dfa state is queued exactly once, when it is created
+  std::queue<int> workQueue;
+  workQueue.push(dfa.startState->id);
 
   while (!workQueue.empty()) {
-    std::set<NFAState *> currentNFAStates = workQueue.front();
+    int currentId = workQueue.front();
     workQueue.pop();
 
-    if (processed.find(currentNFAStates) != processed.end())
-      continue;
-    processed.insert(currentNFAStates);
-
-    DFAState *currentDFAState = stateMapping[currentNFAStates];
-
-    for (char symbol : alphabet) {
-      std::set<NFAState *> nextStates = nfa.move(currentNFAStates, symbol);
-      nextStates = nfa.epsilonClosure(nextStates);
+    const StateSet &currentNFAStates = *dfaStateSets[currentId];
+    DFAState *currentDFAState = dfa.states[currentId].get();
 
+    // every byte of a class moves the same way, move on its representative
+    for (int symbol = 0; symbol < classes.count(); symbol++) {
+      char c = static_cast<char>(classes.representatives[symbol]);
+      StateSet nextStates = nfa.move(currentNFAStates, c);
       if (nextStates.empty())
         continue;
+      nfa.epsilonClosure(nextStates);
 
       DFAState *nextDFAState;
-      if (stateMapping.find(nextStates) == stateMapping.end()) {
-        nextDFAState = dfa.createState(nextStates);
-        stateMapping[nextStates] = nextDFAState;
-        workQueue.push(nextStates);
-
-        // Check for accept states and token types in the next states
-        int bestPriority = INT_MAX;
-        std::optional<std::string> bestTokenType = std::nullopt;
-
-        for (NFAState *nfaState : nextStates) {
-          if (nfaState->isAccept) {
-            nextDFAState->isAccept = true;
-            if (nfaState->tokenType && nfaState->tokenPriority < bestPriority) {
-              // nextDFAState->tokenType = nfaState->tokenType;
-              bestTokenType = nfaState->tokenType;
-              bestPriority = nfaState->tokenPriority;
-            }
-            dfa.acceptStates.insert(nextDFAState);
-          }
-        }
-
-        if (bestTokenType) {
-          nextDFAState->tokenType = bestTokenType;
-          std::cout << "Setting token type for DFA state " << nextDFAState->id
-                    << ": " << *bestTokenType << std::endl;
-        }
+      auto it = stateMapping.find(nextStates);
+      if (it == stateMapping.end()) {
+        nextDFAState = createDFAState(std::move(nextStates));
+        workQueue.push(nextDFAState->id);
       } else {
-        nextDFAState = stateMapping[nextStates];
+        nextDFAState = it->second;
       }
 
       dfa.addTransition(currentDFAState, nextDFAState, symbol);
@@ -155,6 +138,183 @@ DFA SubsetConstruction::convert()
 
 DFA SubsetConstruction::getDFA() { return std::move(dfa); }
 
+DFA HopcroftMinimization::minimize()
+{
+  if (!dfa.startState) {
+    throw std::runtime_error("DFA has no start state");
+  }
+
+  // the dfa is partial, missing transitions go to an explicit dead state so
+  // that states which only differ in where they fail are not merged
+  int stateCount = dfa.states.size();
+  int deadState = stateCount;
+  int totalStates = stateCount + 1;
+  int symbolCount = dfa.classes.count();
+
+  std::vector<std::vector<int>> delta(
+      totalStates, std::vector<int>(symbolCount, deadState));
+  for (const auto &trans : dfa.transitions)
+    delta[trans.from->id][trans.symbol] = trans.to->id;
+
+  // inverse transitions, inverse[symbol][state] = predecessors of state
+  std::vector<std::vector<std::vector<int>>> inverse(
+      symbolCount, std::vector<std::vector<int>>(totalStates));
+  for (int s = 0; s < totalStates; s++) {
+    for (int a = 0; a < symbolCount; a++)
+      inverse[a][delta[s][a]].push_back(s);
+  }
+
+  // initial partition: non-accepting states (including dead) and one block
+  // for each token type
+  std::vector<int> blockOf(totalStates);
+  std::vector<std::vector<int>> blocks;
+  std::map<std::string, int> tokenBlocks;
+  blocks.emplace_back();
+  for (int s = 0; s < totalStates; s++) {
+    DFAState *state = s < stateCount ? dfa.states[s].get() : nullptr;
+    if (!state || !state->isAccept) {
+      blockOf[s] = 0;
+      blocks[0].push_back(s);
+      continue;
+    }
+
+    std::string key = state->tokenType.value_or("");
+    auto it = tokenBlocks.find(key);
+    if (it == tokenBlocks.end()) {
+      it = tokenBlocks.emplace(key, blocks.size()).first;
+      blocks.emplace_back();
+    }
+    blockOf[s] = it->second;
+    blocks[it->second].push_back(s);
+  }
+
+  // seed the worklist with every block except the largest one
+  std::queue<std::pair<int, int>> workList;
+  std::vector<std::vector<bool>> inWorkList;
+  size_t largest = 0;
+  for (size_t b = 1; b < blocks.size(); b++) {
+    if (blocks[b].size() > blocks[largest].size())
+      largest = b;
+  }
+  for (size_t b = 0; b < blocks.size(); b++) {
+    inWorkList.emplace_back(symbolCount, b != largest);
+    if (b == largest)
+      continue;
+    for (int a = 0; a < symbolCount; a++)
+      workList.push({ static_cast<int>(b), a });
+  }
+
+  std::vector<int> touchedCount(totalStates, 0);
+  std::vector<bool> marked(totalStates, false);
+
+  while (!workList.empty()) {
+    auto [splitter, symbol] = workList.front();
+    workList.pop();
+    inWorkList[splitter][symbol] = false;
+
+    // states that move into the splitter block on this symbol
+    std::vector<int> predecessors;
+    for (int s : blocks[splitter]) {
+      for (int p : inverse[symbol][s]) {
+        if (!marked[p]) {
+          marked[p] = true;
+          predecessors.push_back(p);
+        }
+      }
+    }
+
+    std::vector<int> touchedBlocks;
+    for (int p : predecessors) {
+      if (touchedCount[blockOf[p]]++ == 0)
+        touchedBlocks.push_back(blockOf[p]);
+    }
+
+    for (int b : touchedBlocks) {
+      if (touchedCount[b] == static_cast<int>(blocks[b].size())) {
+        touchedCount[b] = 0;
+        continue;
+      }
+      touchedCount[b] = 0;
+
+      std::vector<int> inside, outside;
+      for (int s : blocks[b]) {
+        if (marked[s])
+          inside.push_back(s);
+        else
+          outside.push_back(s);
+      }
+
+      int newBlock = blocks.size();
+      blocks[b] = std::move(outside);
+      blocks.push_back(std::move(inside));
+      for (int s : blocks[newBlock])
+        blockOf[s] = newBlock;
+
+      inWorkList.emplace_back(symbolCount, false);
+      for (int a = 0; a < symbolCount; a++) {
+        if (inWorkList[b][a] ||
+            blocks[newBlock].size() <= blocks[b].size()) {
+          workList.push({ newBlock, a });
+          inWorkList[newBlock][a] = true;
+        } else {
+          workList.push({ b, a });
+          inWorkList[b][a] = true;
+        }
+      }
+    }
+
+    for (int p : predecessors)
+      marked[p] = false;
+  }
+
+  // rebuild the dfa from the blocks, numbering states in breadth-first
+  // order from the start state so equivalent inputs give identical tables.
+  // the block of the dead state is dropped along with transitions into it
+  int deadBlock = blockOf[deadState];
+  std::vector<int> blockToState(blocks.size(), -1);
+  std::vector<int> order;
+  int startBlock = blockOf[dfa.startState->id];
+  blockToState[startBlock] = 0;
+  order.push_back(startBlock);
+
+  for (size_t i = 0; i < order.size(); i++) {
+    int representative = blocks[order[i]].front();
+    for (int a = 0; a < symbolCount; a++) {
+      int target = blockOf[delta[representative][a]];
+      if (target == deadBlock || blockToState[target] != -1)
+        continue;
+      blockToState[target] = order.size();
+      order.push_back(target);
+    }
+  }
+
+  DFA minimized;
+  minimized.classes = dfa.classes;
+  for (int b : order) {
+    DFAState *original = dfa.states[blocks[b].front()].get();
+    DFAState *state = minimized.createState();
+    state->isAccept = original->isAccept;
+    state->tokenType = original->tokenType;
+    if (state->isAccept)
+      minimized.acceptStates.insert(state);
+  }
+  minimized.startState = minimized.states[0].get();
+
+  for (int b : order) {
+    int representative = blocks[b].front();
+    DFAState *from = minimized.states[blockToState[b]].get();
+    for (int a = 0; a < symbolCount; a++) {
+      int target = blockOf[delta[representative][a]];
+      if (target == deadBlock)
+        continue;
+      minimized.addTransition(
+          from, minimized.states[blockToState[target]].get(), a);
+    }
+  }
+
+  return minimized;
+}
+
 MatchResult TransitionTable::matches(const std::string &str)
 {
   std::cout << "Matching string length " << str.length() << ": '";
@@ -172,13 +332,7 @@ MatchResult TransitionTable::matches(const std::string &str)
 
   for (size_t i = 0; i < str.length(); i++) {
     char c = str[i];
-    if (symbolToId.find(c) == symbolToId.end()) {
-      std::cout << "Failed at position " << i << ", char '" << c
-                << "' not in alphabet" << std::endl;
-      return { false, std::nullopt };
-    }
-
-    int next = table[current][symbolToId[c]];
+    int next = this->next(current, c);
     if (next == -1) {
       std::cout << "Failed at position " << i << ", no transition from state "
                 << current << " on char '" << c << "'" << std::endl;
@@ -187,15 +341,342 @@ MatchResult TransitionTable::matches(const std::string &str)
     current = next;
   }
 
-  bool accepts = acceptStateIds.find(current) != acceptStateIds.end();
+  bool accepts = isAccept(current);
   std::cout << "Ended in state " << current
             << (accepts ? " (accepting)" : " (non-accepting)") << std::endl;
 
   return { accepts,
-           accepts ? std::optional<std::string>{ stateTokenTypes[current] }
+           accepts ? std::optional<std::string>{ tokenType(current) }
                    : std::nullopt };
 }
 
+#ifdef __SSE2__
+// bytes that leave the state are set in the returned mask. a byte c lies in
+// [lo, hi] exactly when c - lo <= hi - lo as unsigned bytes, which max_epu8
+// can test, and the sign bit of every byte is set exactly for >= 0x80
+static size_t skipSSE2(const Accelerator &a, const char *text, size_t size)
+{
+  __m128i lo[Accelerator::MAX_RANGES], width[Accelerator::MAX_RANGES];
+  size_t count = a.kind == Accelerator::RANGES ? a.ranges.size()
+                                               : a.escapes.size();
+  for (size_t i = 0; i < count; i++) {
+    if (a.kind == Accelerator::RANGES) {
+      lo[i] = _mm_set1_epi8(a.ranges[i].first);
+      width[i] = _mm_set1_epi8(a.ranges[i].second - a.ranges[i].first);
+    } else {
+      lo[i] = _mm_set1_epi8(a.escapes[i]);
+    }
+  }
+
+  size_t i = 0;
+  for (; i + 16 <= size; i += 16) {
+    __m128i chunk =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(text + i));
+    int mask;
+    if (a.kind == Accelerator::RANGES) {
+      __m128i in = _mm_setzero_si128();
+      for (size_t r = 0; r < count; r++) {
+        __m128i offset = _mm_sub_epi8(chunk, lo[r]);
+        in = _mm_or_si128(
+            in, _mm_cmpeq_epi8(_mm_max_epu8(offset, width[r]), width[r]));
+      }
+      mask = ~_mm_movemask_epi8(in) & 0xFFFF;
+    } else {
+      mask = a.high ? _mm_movemask_epi8(chunk) : 0;
+      for (size_t e = 0; e < count; e++)
+        mask |= _mm_movemask_epi8(_mm_cmpeq_epi8(chunk, lo[e]));
+    }
+    if (mask)
+      return i + __builtin_ctz(mask);
+  }
+
+  while (i < size && !a.stops[static_cast<unsigned char>(text[i])])
+    i++;
+  return i;
+}
+
+// skipSSE2() 32 bytes at a time, only called when the cpu has AVX2
+__attribute__((target("avx2"))) static size_t
+skipAVX2(const Accelerator &a, const char *text, size_t size)
+{
+  __m256i lo[Accelerator::MAX_RANGES], width[Accelerator::MAX_RANGES];
+  size_t count = a.kind == Accelerator::RANGES ? a.ranges.size()
+                                               : a.escapes.size();
+  for (size_t i = 0; i < count; i++) {
+    if (a.kind == Accelerator::RANGES) {
+      lo[i] = _mm256_set1_epi8(a.ranges[i].first);
+      width[i] = _mm256_set1_epi8(a.ranges[i].second - a.ranges[i].first);
+    } else {
+      lo[i] = _mm256_set1_epi8(a.escapes[i]);
+    }
+  }
+
+  size_t i = 0;
+  for (; i + 32 <= size; i += 32) {
+    __m256i chunk =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(text + i));
+    unsigned mask;
+    if (a.kind == Accelerator::RANGES) {
+      __m256i in = _mm256_setzero_si256();
+      for (size_t r = 0; r < count; r++) {
+        __m256i offset = _mm256_sub_epi8(chunk, lo[r]);
+        in = _mm256_or_si256(
+            in,
+            _mm256_cmpeq_epi8(_mm256_max_epu8(offset, width[r]), width[r]));
+      }
+      mask = ~static_cast<unsigned>(_mm256_movemask_epi8(in));
+    } else {
+      mask = a.high ? _mm256_movemask_epi8(chunk) : 0;
+      for (size_t e = 0; e < count; e++)
+        mask |= _mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, lo[e]));
+    }
+    if (mask)
+      return i + __builtin_ctz(mask);
+  }
+
+  return i + skipSSE2(a, text + i, size - i);
+}
+#endif
+
+size_t Accelerator::skip(const char *text, size_t size) const
+{
+  if (kind == ESCAPES && !high && escapes.size() == 1) {
+    const void *hit = std::memchr(text, escapes[0], size);
+    return hit ? static_cast<const char *>(hit) - text : size;
+  }
+
+#ifdef __SSE2__
+  static const bool avx2 = __builtin_cpu_supports("avx2");
+  return avx2 ? skipAVX2(*this, text, size) : skipSSE2(*this, text, size);
+#else
+  size_t i = 0;
+  while (i < size && !stops[static_cast<unsigned char>(text[i])])
+    i++;
+  return i;
+#endif
+}
+
+Accelerator findAccelerator(int state, const int next[256])
+{
+  Accelerator accelerator;
+
+  int highEscapes = 0;
+  for (int b = 0; b < 256; b++) {
+    if (next[b] == state)
+      continue;
+    accelerator.stops[b] = true;
+    if (b >= 0x80)
+      highEscapes++;
+    else
+      accelerator.escapes.push_back(static_cast<char>(b));
+  }
+
+  if (accelerator.escapes.size() <= Accelerator::MAX_ESCAPES &&
+      (highEscapes == 0 || highEscapes == 0x80)) {
+    accelerator.kind = Accelerator::ESCAPES;
+    accelerator.high = highEscapes != 0;
+    return accelerator;
+  }
+  accelerator.escapes.clear();
+
+  auto &ranges = accelerator.ranges;
+  for (int b = 0; b < 256; b++) {
+    if (accelerator.stops[b])
+      continue;
+    if (!ranges.empty() && ranges.back().second == b - 1)
+      ranges.back().second = b;
+    else if (ranges.size() < Accelerator::MAX_RANGES)
+      ranges.emplace_back(b, b);
+    else
+      return Accelerator();
+  }
+
+  if (accelerator.ranges.empty())
+    return Accelerator();
+  accelerator.kind = Accelerator::RANGES;
+  return accelerator;
+}
+
+const std::string &TransitionTable::tokenType(int state) const
+{
+  static const std::string none;
+  int token = states[state].token;
+  return token != -1 ? tokenNames[token] : none;
+}
+
+CombTable::CombTable(const TransitionTable &table)
+    : classOf(table.columnOf.begin(), table.columnOf.end()),
+      tokenNames(table.tokenNames), accelerators(table.accelerators),
+      startStateId(table.startStateId)
+{
+  int stateCount = static_cast<int>(table.stateCount());
+  int columnCount = static_cast<int>(table.columnCount());
+
+  for (int s = 0; s < stateCount; s++)
+    stateTokens.push_back(table.states[s].token);
+
+  // choose defaults. like flex, only the most recent states that have no
+  // default of their own are tried, which keeps this linear in the table
+  // size, and a default is only taken when it saves more than half the row
+  const size_t maxCandidates = 64;
+  std::vector<int> candidates;
+  std::vector<std::vector<int>> columns(stateCount);
+  def.assign(stateCount, -1);
+  for (int s = 0; s < stateCount; s++) {
+    const int *row = &table.transitions[s * columnCount];
+    int used = 0;
+    for (int c = 0; c < columnCount; c++)
+      used += row[c] != -1;
+
+    int best = -1;
+    int bestDiff = used / 2;
+    for (int candidate : candidates) {
+      const int *other = &table.transitions[candidate * columnCount];
+      int diff = 0;
+      for (int c = 0; c < columnCount && diff < bestDiff; c++)
+        diff += row[c] != other[c];
+      if (diff < bestDiff) {
+        best = candidate;
+        bestDiff = diff;
+      }
+    }
+
+    def[s] = best;
+    for (int c = 0; c < columnCount; c++) {
+      if (best != -1 ? row[c] != table.at(best, c) : row[c] != -1)
+        columns[s].push_back(c);
+    }
+    if (best == -1) {
+      if (candidates.size() == maxCandidates)
+        candidates.erase(candidates.begin());
+      candidates.push_back(s);
+    }
+  }
+
+  // first fit, fullest rows first so the sparse ones fill the gaps
+  std::vector<int> order(stateCount);
+  for (int s = 0; s < stateCount; s++)
+    order[s] = s;
+  std::stable_sort(order.begin(), order.end(), [&](int a, int b) {
+    return columns[a].size() > columns[b].size();
+  });
+
+  base.assign(stateCount, 0);
+  int firstFree = 0;
+  for (int s : order) {
+    if (columns[s].empty())
+      continue;
+    int b = std::max(0, firstFree - columns[s].front());
+    for (;; b++) {
+      bool fits = true;
+      for (int c : columns[s]) {
+        if (b + c < (int)chk.size() && chk[b + c] != -1) {
+          fits = false;
+          break;
+        }
+      }
+      if (fits)
+        break;
+    }
+
+    base[s] = b;
+    if (b + columnCount > (int)chk.size()) {
+      chk.resize(b + columnCount, -1);
+      nxt.resize(b + columnCount, -1);
+    }
+    for (int c : columns[s]) {
+      chk[b + c] = s;
+      nxt[b + c] = table.at(s, c);
+    }
+    while (firstFree < (int)chk.size() && chk[firstFree] != -1)
+      firstFree++;
+  }
+
+  // every base + column has to be in bounds, including empty rows at 0
+  if ((int)chk.size() < columnCount) {
+    chk.resize(columnCount, -1);
+    nxt.resize(columnCount, -1);
+  }
+}
+
+std::optional<std::string> literalText(const std::string &pattern)
+{
+  std::string text;
+  RegexLexer lexer(pattern);
+  for (const Token &token : lexer.tokenize()) {
+    if (token.type == TokenType::END)
+      break;
+    if (token.type != TokenType::CHAR)
+      return std::nullopt;
+    text += token.value;
+  }
+  return text;
+}
+
+KeywordTable::KeywordTable(const std::vector<Keyword> &keywords)
+    : seed(0), shift(0), minLength(0), maxLength(0)
+{
+  std::map<uint32_t, std::vector<const Keyword *>> byKey;
+  for (const Keyword &keyword : keywords)
+    byKey[key(keyword.text.data(), keyword.text.size())].push_back(&keyword);
+
+  std::vector<std::pair<uint32_t, const Keyword *>> unique;
+  for (const auto &entry : byKey)
+    if (entry.second.size() == 1)
+      unique.emplace_back(entry.first, entry.second[0]);
+  if (unique.empty())
+    return;
+
+  minLength = SIZE_MAX;
+  for (const auto &entry : unique) {
+    minLength = std::min(minLength, entry.second->text.size());
+    maxLength = std::max(maxLength, entry.second->text.size());
+  }
+
+  // at least two slots a keyword. a random seed places n keywords in m
+  // slots without a collision with probability about exp(-n * n / 2m), so
+  // the table doubles if 65536 seeds in a row collide
+  int bits = 1;
+  while ((size_t{ 1 } << bits) < 2 * unique.size())
+    bits++;
+
+  // small multipliers leave the top bits of key * seed to the length, so
+  // the seeds are spread over the whole range by a golden ratio step
+  std::vector<bool> used;
+  for (;; bits++) {
+    size_t size = size_t{ 1 } << bits;
+    for (uint32_t i = 1; i <= 65536; i++) {
+      uint32_t s = i * 0x9e3779b9u | 1;
+      used.assign(size, false);
+      bool collision = false;
+      for (const auto &entry : unique) {
+        size_t slot = entry.first * s >> (32 - bits);
+        collision = used[slot];
+        if (collision)
+          break;
+        used[slot] = true;
+      }
+      if (collision)
+        continue;
+
+      seed = s;
+      shift = 32 - bits;
+      slots.assign(size, Keyword());
+      for (const auto &entry : unique)
+        slots[entry.first * s >> shift] = *entry.second;
+      return;
+    }
+  }
+}
+
+size_t KeywordTable::size() const
+{
+  size_t count = 0;
+  for (const Keyword &slot : slots)
+    count += !slot.text.empty();
+  return count;
+}
+
 TransitionTable TransitionTableBuilder::build()
 {
   TransitionTable table;
@@ -204,14 +685,12 @@ TransitionTable TransitionTableBuilder::build()
     throw std::runtime_error("DFA has no start state");
   }
 
-  std::set<char> alphabet;
-  for (const auto &trans : dfa.transitions) {
-    alphabet.insert(trans.symbol);
-  }
-  table.alphabet = std::vector<char>(alphabet.begin(), alphabet.end());
+  // one column per byte class, labelled with the class representative
+  for (unsigned char c : dfa.classes.representatives)
+    table.alphabet.push_back(static_cast<char>(c));
 
   std::cout << "Alphabet contents: ";
-  for (char c : alphabet) {
+  for (char c : table.alphabet) {
     if (c == '"')
       std::cout << "\\\"";
     else if (c == '\n')
@@ -221,47 +700,57 @@ TransitionTable TransitionTableBuilder::build()
   }
   std::cout << std::endl;
 
-  for (size_t i = 0; i < table.alphabet.size(); i++) {
-    table.symbolToId[table.alphabet[i]] = i;
-  }
+  for (int b = 0; b < 256; b++)
+    table.columnOf[b] = dfa.classes.classOf[b];
 
   size_t statesCount = dfa.states.size();
   size_t symbolCount = table.alphabet.size();
-  table.table.resize(statesCount, std::vector<int>(symbolCount, -1));
-
-  for (const auto &trans : dfa.transitions) {
-    int from = trans.from->id;
-    int to = trans.to->id;
-    int symb = table.symbolToId[trans.symbol];
+  table.transitions.assign(statesCount * symbolCount, -1);
 
-    table.table[from][symb] = to;
-  }
+  for (const auto &trans : dfa.transitions)
+    table.transitions[trans.from->id * symbolCount + trans.symbol] =
+        trans.to->id;
 
   table.startStateId = dfa.startState->id;
 
+  // token ids are handed out in state order, which the generated files and
+  // table images rely on
+  std::vector<const std::string *> types(statesCount, nullptr);
+  table.states.assign(statesCount, { false, -1 });
   for (const auto &state : dfa.acceptStates) {
-    table.acceptStateIds.insert(state->id);
-    if (state->tokenType) {
-      table.stateTokenTypes[state->id] = *(state->tokenType);
+    table.states[state->id].accept = true;
+    if (state->tokenType)
+      types[state->id] = &*state->tokenType;
+  }
+  std::map<std::string, int> tokenIds;
+  for (size_t s = 0; s < statesCount; s++) {
+    if (!types[s])
+      continue;
+    auto it = tokenIds.find(*types[s]);
+    if (it == tokenIds.end()) {
+      it = tokenIds.emplace(*types[s], table.tokenNames.size()).first;
+      table.tokenNames.push_back(*types[s]);
     }
+    table.states[s].token = it->second;
+  }
+
+  for (size_t s = 0; s < statesCount; s++) {
+    int next[256];
+    for (int b = 0; b < 256; b++)
+      next[b] = table.at(s, dfa.classes.classOf[b]);
+    table.accelerators.push_back(findAccelerator(s, next));
   }
 
   return table;
 }
 
-TransitionTable TransitionTableGenerator::generate()
+std::vector<std::shared_ptr<ASTNode>>
+TransitionTableGenerator::parsePatterns(const std::vector<RegexPattern> &pats,
+                                        ByteClasses &classes)
 {
-  // Combine NFAs for all regex patterns
-  NFA combinedNFA;
-  ThompsonConstruction thompson(combinedNFA);
+  std::vector<std::shared_ptr<ASTNode>> roots;
 
-  NFAState *globalStart = combinedNFA.createState();
-  NFAState *globalAccept = combinedNFA.createState();
-  combinedNFA.startState = globalStart;
-  combinedNFA.acceptState = globalAccept;
-  globalAccept->isAccept = false;
-
-  for (const auto &pattern : patterns) {
+  for (const auto &pattern : pats) {
     std::cout << "Processing pattern: " << pattern.pattern << std::endl;
 
     RegexLexer lexer(pattern.pattern);
@@ -296,7 +785,32 @@ TransitionTable TransitionTableGenerator::generate()
     auto ASTroot = parser.parse();
     std::cout << "Parsed AST." << std::endl;
 
-    auto fragment = thompson.build(ASTroot);
+    // bytes that no pattern tells apart share one column of the table
+    classes.refine(ASTroot);
+    roots.push_back(ASTroot);
+  }
+
+  return roots;
+}
+
+NFA TransitionTableGenerator::buildThompsonNFA(
+    const std::vector<RegexPattern> &pats,
+    const std::vector<std::shared_ptr<ASTNode>> &roots)
+{
+  // Combine NFAs for all regex patterns
+  NFA combinedNFA;
+  ThompsonConstruction thompson(combinedNFA);
+
+  NFAState *globalStart = combinedNFA.createState();
+  NFAState *globalAccept = combinedNFA.createState();
+  combinedNFA.startState = globalStart;
+  combinedNFA.acceptState = globalAccept;
+  globalAccept->isAccept = false;
+
+  for (size_t i = 0; i < pats.size(); i++) {
+    const RegexPattern &pattern = pats[i];
+
+    auto fragment = thompson.build(roots[i]);
     std::cout << "Built NFA fragment." << std::endl;
 
     // Ensure fragment's accept is not left marked as final
@@ -313,15 +827,509 @@ TransitionTable TransitionTableGenerator::generate()
     combinedNFA.addTransition(fragment.accept, globalAccept, '\0');
   }
 
-  SubsetConstruction subsetConv(combinedNFA);
-  DFA dfa = subsetConv.convert();
+  combinedNFA.computeClosures();
+  return combinedNFA;
+}
 
-  TransitionTableBuilder tableBuilder(dfa);
+NFA TransitionTableGenerator::buildNFA()
+{
+  ByteClasses classes;
+  return buildThompsonNFA(patterns, parsePatterns(patterns, classes));
+}
+
+TransitionTable
+TransitionTableGenerator::build(const std::vector<RegexPattern> &pats)
+{
+  ByteClasses classes;
+  std::vector<std::shared_ptr<ASTNode>> roots = parsePatterns(pats, classes);
+
+  DFA dfa;
+  if (construction == Construction::FOLLOWPOS) {
+    dfa = FollowposConstruction(roots, pats, classes).convert();
+  } else {
+    NFA nfa = buildThompsonNFA(pats, roots);
+    SubsetConstruction subsetConv(nfa, classes);
+    dfa = subsetConv.convert();
+  }
+  size_t symbolCount = classes.count();
+
+  HopcroftMinimization minimizer(dfa);
+  DFA minimized = minimizer.minimize();
+
+  std::cout << "DFA minimization: " << dfa.states.size() << " -> "
+            << minimized.states.size() << " states ("
+            << dfa.states.size() * symbolCount * sizeof(int) << " -> "
+            << minimized.states.size() * symbolCount * sizeof(int)
+            << " table bytes)" << std::endl;
+
+  TransitionTableBuilder tableBuilder(minimized);
   TransitionTable table = tableBuilder.build();
 
   return table;
 }
 
+TransitionTable TransitionTableGenerator::generate()
+{
+  keywords = KeywordTable();
+  if (keywordMode == KeywordMode::DFA)
+    return build(patterns);
+
+  // leave out every literal, then put back the ones the remaining patterns
+  // don't resolve to a catch-all. a literal that is put back can change how
+  // another literal with the same text resolves, so repeat until none do
+  std::vector<bool> dropped(patterns.size());
+  for (size_t i = 0; i < patterns.size(); i++)
+    dropped[i] = literalText(patterns[i].pattern).has_value();
+
+  while (true) {
+    std::vector<RegexPattern> kept;
+    for (size_t i = 0; i < patterns.size(); i++)
+      if (!dropped[i])
+        kept.push_back(patterns[i]);
+
+    TransitionTable table = build(kept);
+    KeywordTable found = KeywordTable::find(patterns, table);
+
+    bool stable = true;
+    for (size_t i = 0; i < patterns.size(); i++) {
+      if (dropped[i] && !found.lookup(*literalText(patterns[i].pattern))) {
+        dropped[i] = false;
+        stable = false;
+      }
+    }
+
+    if (stable) {
+      std::cout << "Keyword hashing: " << patterns.size() - kept.size()
+                << " literal patterns moved to a " << found.slots.size()
+                << " slot keyword table" << std::endl;
+      keywords = std::move(found);
+      return table;
+    }
+  }
+}
+
+// helper to produce a C char literal with escapes
+static std::string escapeChar(char c)
+{
+  switch (c) {
+    case '\n':
+      return "\\n";
+    case '\r':
+      return "\\r";
+    case '\t':
+      return "\\t";
+    case '\\':
+      return "\\\\";
+    case '\'':
+      return "\\'";
+    case '\"':
+      return "\\\"";
+    default:
+      if (std::isprint(static_cast<unsigned char>(c)))
+        return std::string(1, c);
+      char buf[5];
+      std::snprintf(buf, sizeof(buf), "\\x%02X", static_cast<unsigned char>(c));
+      return std::string(buf);
+  }
+}
+
+// sanitize token enum names to be valid C identifiers
+static std::string sanitizeIdentifier(const std::string &s)
+{
+  std::string out;
+  for (size_t i = 0; i < s.size(); ++i) {
+    char ch = s[i];
+    if ((i == 0 && std::isalpha((unsigned char)ch)) ||
+        (i > 0 && (std::isalnum((unsigned char)ch) || ch == '_')))
+      out.push_back(ch);
+    else
+      out.push_back('_');
+  }
+  if (out.empty() || !std::isalpha((unsigned char)out[0]))
+    out = "T_" + out;
+  return out;
+}
+
+// writes the elements of a C array initializer wrapped at 80 columns. the
+// caller has already written the first line up to the indentation, which is
+// the same 8 space style used by the C sources
+static void writeCInitializer(std::ostream &out,
+                              const std::vector<std::string> &items,
+                              size_t indent = 8)
+{
+  size_t column = indent;
+  for (size_t i = 0; i < items.size(); ++i) {
+    std::string item = items[i] + (i + 1 < items.size() ? "," : "");
+    if (column > indent && column + 1 + item.size() > 80) {
+      out << "\n" << std::string(indent, ' ');
+      column = indent;
+    } else if (column > indent) {
+      out << " ";
+      column++;
+    }
+    out << item;
+    column += item.size();
+  }
+}
+
+// C literal for byte b as a case label or comparison operand
+static std::string byteLiteral(int b)
+{
+  if (b < 0x80 && std::isprint(b))
+    return "'" + escapeChar(static_cast<char>(b)) + "'";
+  char buf[5];
+  std::snprintf(buf, sizeof(buf), "0x%02X", b);
+  return std::string(buf);
+}
+
+// emits the ACCEL table, only accelerated states are listed, and
+// accel_skip(), which tests 32 or 16 bytes at a time with AVX2 or SSE2
+static void writeAccelerators(std::ostream &out, const TransitionTable &table)
+{
+  out << "const struct accel ACCEL[STATE_COUNT] = {\n";
+  for (size_t s = 0; s < table.accelerators.size(); s++) {
+    const Accelerator &accelerator = table.accelerators[s];
+    std::vector<std::string> items;
+    if (accelerator.kind == Accelerator::ESCAPES) {
+      std::string escapes;
+      for (char c : accelerator.escapes)
+        escapes += (escapes.empty() ? "" : ", ") +
+            byteLiteral(static_cast<unsigned char>(c));
+      items.push_back(".kind = ACCEL_ESCAPES");
+      items.push_back(".high = " + std::to_string(accelerator.high));
+      items.push_back(".count = " + std::to_string(accelerator.escapes.size()));
+      if (!escapes.empty())
+        items.push_back(".escapes = { " + escapes + " }");
+    } else if (accelerator.kind == Accelerator::RANGES) {
+      std::string ranges;
+      for (const auto &range : accelerator.ranges)
+        ranges += (ranges.empty() ? "{ " : ", { ") +
+            byteLiteral(range.first) + ", " + byteLiteral(range.second) + " }";
+      items.push_back(".kind = ACCEL_RANGES");
+      items.push_back(".count = " + std::to_string(accelerator.ranges.size()));
+      items.push_back(".ranges = { " + ranges + " }");
+    } else {
+      continue;
+    }
+    out << "        [" << s << "] = { ";
+    writeCInitializer(out, items, 16);
+    out << " },\n";
+  }
+  out << "};\n\n";
+
+  out << R"(/* whether c keeps a ranges accelerator in its state */
+static int accel_in_ranges(const struct accel *a, unsigned char c)
+{
+        for (int i = 0; i < a->count; i++) {
+                if (c >= a->ranges[i][0] && c <= a->ranges[i][1])
+                        return 1;
+        }
+        return 0;
+}
+
+static const unsigned char *accel_skip_scalar(const unsigned char *p,
+                                              const unsigned char *end,
+                                              const struct accel *a)
+{
+        if (a->kind == ACCEL_RANGES) {
+                while (p < end && accel_in_ranges(a, *p))
+                        p++;
+                return p;
+        }
+
+        for (; p < end; p++) {
+                if (a->high && *p >= 0x80)
+                        return p;
+                for (int i = 0; i < a->count; i++) {
+                        if (*p == a->escapes[i])
+                                return p;
+                }
+        }
+        return end;
+}
+
+#ifdef __SSE2__
+/*
+ * stop bytes are marked in the returned mask. a byte c lies in [lo, hi]
+ * exactly when c - lo <= hi - lo as unsigned bytes, which SSE2 can test
+ * with max_epu8, and the sign bit of every byte is set exactly for >= 0x80
+ */
+static const unsigned char *accel_skip_sse2(const unsigned char *p,
+                                            const unsigned char *end,
+                                            const struct accel *a)
+{
+        __m128i lo[ACCEL_MAX_RANGES], width[ACCEL_MAX_RANGES];
+        for (int i = 0; i < a->count; i++) {
+                if (a->kind == ACCEL_RANGES) {
+                        lo[i] = _mm_set1_epi8((char)a->ranges[i][0]);
+                        width[i] = _mm_set1_epi8(
+                            (char)(a->ranges[i][1] - a->ranges[i][0]));
+                } else {
+                        lo[i] = _mm_set1_epi8((char)a->escapes[i]);
+                }
+        }
+
+        for (; end - p >= 16; p += 16) {
+                __m128i chunk = _mm_loadu_si128((const __m128i *)p);
+                int mask;
+                if (a->kind == ACCEL_RANGES) {
+                        __m128i in = _mm_setzero_si128();
+                        for (int i = 0; i < a->count; i++) {
+                                __m128i offset = _mm_sub_epi8(chunk, lo[i]);
+                                in = _mm_or_si128(
+                                    in,
+                                    _mm_cmpeq_epi8(
+                                        _mm_max_epu8(offset, width[i]),
+                                        width[i]));
+                        }
+                        mask = ~_mm_movemask_epi8(in) & 0xFFFF;
+                } else {
+                        mask = a->high ? _mm_movemask_epi8(chunk) : 0;
+                        for (int i = 0; i < a->count; i++)
+                                mask |= _mm_movemask_epi8(
+                                    _mm_cmpeq_epi8(chunk, lo[i]));
+                }
+                if (mask)
+                        return p + __builtin_ctz(mask);
+        }
+
+        return accel_skip_scalar(p, end, a);
+}
+#endif
+
+#ifdef ACCEL_HAVE_AVX2
+/* accel_skip_sse2() 32 bytes at a time, only called when the cpu has avx2 */
+__attribute__((target("avx2"))) static const unsigned char *
+accel_skip_avx2(const unsigned char *p,
+                const unsigned char *end,
+                const struct accel *a)
+{
+        __m256i lo[ACCEL_MAX_RANGES], width[ACCEL_MAX_RANGES];
+        for (int i = 0; i < a->count; i++) {
+                if (a->kind == ACCEL_RANGES) {
+                        lo[i] = _mm256_set1_epi8((char)a->ranges[i][0]);
+                        width[i] = _mm256_set1_epi8(
+                            (char)(a->ranges[i][1] - a->ranges[i][0]));
+                } else {
+                        lo[i] = _mm256_set1_epi8((char)a->escapes[i]);
+                }
+        }
+
+        for (; end - p >= 32; p += 32) {
+                __m256i chunk = _mm256_loadu_si256((const __m256i *)p);
+                unsigned mask;
+                if (a->kind == ACCEL_RANGES) {
+                        __m256i in = _mm256_setzero_si256();
+                        for (int i = 0; i < a->count; i++) {
+                                __m256i offset =
+                                    _mm256_sub_epi8(chunk, lo[i]);
+                                in = _mm256_or_si256(
+                                    in,
+                                    _mm256_cmpeq_epi8(
+                                        _mm256_max_epu8(offset, width[i]),
+                                        width[i]));
+                        }
+                        mask = ~(unsigned)_mm256_movemask_epi8(in);
+                } else {
+                        mask = a->high ? (unsigned)_mm256_movemask_epi8(chunk)
+                                       : 0;
+                        for (int i = 0; i < a->count; i++)
+                                mask |= (unsigned)_mm256_movemask_epi8(
+                                    _mm256_cmpeq_epi8(chunk, lo[i]));
+                }
+                if (mask)
+                        return p + __builtin_ctz(mask);
+        }
+
+        return accel_skip_sse2(p, end, a);
+}
+#endif
+
+const unsigned char *accel_skip(const unsigned char *p,
+                                const unsigned char *end,
+                                const struct accel *a)
+{
+        if (a->kind == ACCEL_ESCAPES && !a->high && a->count == 1) {
+                const unsigned char *hit = memchr(p, a->escapes[0], end - p);
+                return hit ? hit : end;
+        }
+
+#ifdef ACCEL_HAVE_AVX2
+        // reads what libgcc found before main, so threads can share it
+        if (__builtin_cpu_supports("avx2"))
+                return accel_skip_avx2(p, end, a);
+#endif
+#ifdef __SSE2__
+        return accel_skip_sse2(p, end, a);
+#else
+        return accel_skip_scalar(p, end, a);
+#endif
+}
+)";
+  out << "\n";
+}
+
+// emits dfa_match() as re2c style direct code. every state is a label that
+// records the match if it accepts, then dispatches on the next byte with
+// range compares when the row has few runs of equal targets and a switch
+// otherwise. only labels that are jumped to are written, so the output
+// compiles cleanly with -Wall
+static void writeDirectScanner(std::ostream &out, const TransitionTable &table)
+{
+  int stateCount = static_cast<int>(table.stateCount());
+  int start = table.startStateId;
+  const int maxCompares = 4;
+
+  // target of every byte, per state
+  std::vector<std::vector<int>> targets(stateCount, std::vector<int>(256));
+  std::vector<bool> jumpedTo(stateCount, false);
+  for (int s = 0; s < stateCount; s++) {
+    for (int b = 0; b < 256; b++) {
+      int to = table.at(s, table.columnOf[b]);
+      targets[s][b] = to;
+      if (to != -1)
+        jumpedTo[to] = true;
+    }
+  }
+
+  // the start state consumes no input, so nothing is skipped or recorded on
+  // entry. that only happens when a transition leads back to it
+  bool startReentered = jumpedTo[start] &&
+      (table.isAccept(start) ||
+       table.accelerators[start].enabled());
+
+  out << "size_t dfa_match(const char *src, size_t len, int *accept_state)\n";
+  out << "{\n";
+  out << "        const unsigned char *p = (const unsigned char *)src;\n";
+  out << "        const unsigned char *end = p + len;\n";
+  out << "        size_t match = 0;\n";
+  out << "        int accept = -1;\n";
+  out << "        int run = 0;\n";
+  out << "        unsigned char c;\n\n";
+  if (startReentered)
+    out << "        goto dispatch_" << start << ";\n\n";
+
+  // start first so that the function falls into it
+  std::vector<int> order;
+  order.push_back(start);
+  for (int s = 0; s < stateCount; s++) {
+    if (s != start)
+      order.push_back(s);
+  }
+
+  for (int s : order) {
+    if (s != start && !jumpedTo[s])
+      continue;
+
+    // an accelerated state counts its loops on itself in run, like
+    // dfa_match() in lexer.c, and skips once the run is long enough
+    bool accelerated = table.accelerators[s].enabled();
+    auto label = [&](int to) {
+      return "s" + std::to_string(to) + (to == s && accelerated ? "_self" : "");
+    };
+
+    if (jumpedTo[s]) {
+      out << "s" << s << ":\n";
+      if (accelerated) {
+        out << "        run = 0;\n";
+        out << "s" << s << "_body:\n";
+      }
+      if (table.isAccept(s)) {
+        out << "        match = p - (const unsigned char *)src;\n";
+        out << "        accept = " << s << ";\n";
+      }
+    }
+    if (s == start && startReentered)
+      out << "dispatch_" << s << ":\n";
+
+    // runs of consecutive bytes with the same target
+    struct Run {
+      int lo, hi, to;
+    };
+    std::vector<Run> runs;
+    std::map<int, int> bytesPerTarget;
+    for (int b = 0; b < 256; b++) {
+      int to = targets[s][b];
+      if (to == -1)
+        continue;
+      bytesPerTarget[to]++;
+      if (!runs.empty() && runs.back().hi == b - 1 && runs.back().to == to)
+        runs.back().hi = b;
+      else
+        runs.push_back({ b, b, to });
+    }
+
+    if (runs.empty()) {
+      out << "        goto done;\n";
+      continue;
+    }
+
+    out << "        if (p == end)\n";
+    out << "                goto done;\n";
+    out << "        c = *p++;\n";
+
+    if ((int)runs.size() <= maxCompares) {
+      for (const Run &run : runs) {
+        out << "        if (";
+        if (run.lo == run.hi)
+          out << "c == " << byteLiteral(run.lo);
+        else if (run.lo == 0)
+          out << "c <= " << byteLiteral(run.hi);
+        else if (run.hi == 255)
+          out << "c >= " << byteLiteral(run.lo);
+        else
+          out << "c >= " << byteLiteral(run.lo) << " && c <= "
+              << byteLiteral(run.hi);
+        out << ")\n";
+        out << "                goto " << label(run.to) << ";\n";
+      }
+      out << "        goto done;\n";
+    } else {
+      // the switch falls back to the target that covers the most bytes,
+      // which is usually no transition at all
+      int fallback = -1;
+      int fallbackBytes = 256;
+      for (const auto &pair : bytesPerTarget)
+        fallbackBytes -= pair.second;
+      for (const auto &pair : bytesPerTarget) {
+        if (pair.second > fallbackBytes) {
+          fallback = pair.first;
+          fallbackBytes = pair.second;
+        }
+      }
+
+      out << "        switch (c) {\n";
+      for (const auto &pair : bytesPerTarget) {
+        if (pair.first == fallback)
+          continue;
+        for (int b = 0; b < 256; b++) {
+          if (targets[s][b] == pair.first)
+            out << "        case " << byteLiteral(b) << ":\n";
+        }
+        out << "                goto " << label(pair.first) << ";\n";
+      }
+      out << "        default:\n";
+      if (fallback == -1)
+        out << "                goto done;\n";
+      else
+        out << "                goto " << label(fallback) << ";\n";
+      out << "        }\n";
+    }
+
+    if (accelerated) {
+      out << "s" << s << "_self:\n";
+      out << "        if (++run == ACCEL_MIN_RUN)\n";
+      out << "                p = accel_skip(p, end, &ACCEL[" << s << "]);\n";
+      out << "        goto s" << s << "_body;\n";
+    }
+  }
+
+  out << "\ndone:\n";
+  out << "        *accept_state = accept;\n";
+  out << "        return match;\n";
+  out << "}\n\n";
+}
+
 void TransitionTableGenerator::generateToFile(const std::string &filename)
 {
   TransitionTable table = generate();
@@ -333,49 +1341,184 @@ void TransitionTableGenerator::generateToFile(const std::string &filename)
   }
 
   // table sizes
-  int stateCount = static_cast<int>(table.table.size());
-  int symbolCount = static_cast<int>(table.alphabet.size());
+  int stateCount = static_cast<int>(table.stateCount());
+  int symbolCount = static_cast<int>(table.columnCount());
+
+  // build deterministic token type id map
+  std::map<std::string, int> tokenTypeIds;
+  int tokenCounter = 0;
+  for (const std::string &tt : table.tokenNames)
+    tokenTypeIds[tt] = tokenCounter++;
+  // keyword types no state accepts any more still need their ids
+  for (const auto &slot : keywords.slots) {
+    if (!slot.text.empty() &&
+        tokenTypeIds.find(slot.tokenType) == tokenTypeIds.end())
+      tokenTypeIds[slot.tokenType] = tokenCounter++;
+  }
+
+  // narrowest state id type, its largest value marks a missing transition
+  std::string stateType = "int";
+  std::string noState = "-1";
+  if (stateCount < UINT8_MAX) {
+    stateType = "uint8_t";
+    noState = std::to_string(UINT8_MAX);
+  } else if (stateCount < UINT16_MAX) {
+    stateType = "uint16_t";
+    noState = std::to_string(UINT16_MAX);
+  }
+  // packed entries keep the accept flag in the bit above the state id, so
+  // the id gets just enough bits for STATE_COUNT states and NO_STATE
+  long long packedAccept = 0;
+  if (encoding == TableEncoding::PACKED) {
+    int bits = 1;
+    while ((1LL << bits) <= stateCount)
+      bits++;
+    packedAccept = 1LL << bits;
+    stateType = bits < 8 ? "uint8_t" : bits < 16 ? "uint16_t" : "uint32_t";
+    noState = std::to_string(packedAccept - 1);
+  }
+  auto stateId = [&](int state) {
+    return state == -1 ? noState : std::to_string(state);
+  };
+
+  std::optional<CombTable> comb;
+  std::string baseType;
+  if (encoding == TableEncoding::COMB) {
+    comb.emplace(table);
+    baseType = comb->nxt.size() <= UINT16_MAX ? "uint16_t" : "uint32_t";
+  }
 
   headerFile << "#ifndef TRANSITION_TABLE_H\n";
   headerFile << "#define TRANSITION_TABLE_H\n\n";
+  headerFile << "#include <limits.h>\n";
+  headerFile << "#include <stddef.h>\n";
+  headerFile << "#include <stdint.h>\n\n";
   headerFile << "#define STATE_COUNT " << stateCount << "\n";
   headerFile << "#define SYMBOL_COUNT " << symbolCount << "\n\n";
+  headerFile << "typedef " << stateType << " state_id_t;\n";
+  headerFile << "#define NO_STATE " << noState << "\n\n";
   headerFile << "extern const char ALPHABET[SYMBOL_COUNT];\n";
-  headerFile << "extern const int SYMBOL_TO_ID[256];\n";
-  headerFile
-      << "extern const int TRANSITION_TABLE[STATE_COUNT][SYMBOL_COUNT];\n\n";
+  headerFile << "extern const unsigned char SYMBOL_TO_ID[256];\n\n";
+  headerFile << "#define ACCEL_MAX_ESCAPES " << Accelerator::MAX_ESCAPES
+             << "\n";
+  headerFile << "#define ACCEL_MAX_RANGES " << Accelerator::MAX_RANGES
+             << "\n";
+  headerFile << "#define ACCEL_MIN_RUN " << Accelerator::MIN_RUN << "\n\n";
+  headerFile << R"(enum { ACCEL_NONE, ACCEL_ESCAPES, ACCEL_RANGES };
+
+/*
+ * skip accelerator of a state that goes back to itself on most bytes, zero
+ * for other states. an ACCEL_ESCAPES state loops on every byte except its
+ * escapes, like the inside of a comment. an ACCEL_RANGES state loops on the
+ * bytes in its ranges, like the rest of an identifier
+ */
+struct accel {
+        unsigned char kind;
+        unsigned char high; /* every byte >= 0x80 escapes as well */
+        unsigned char count; /* escapes or ranges */
+        unsigned char escapes[ACCEL_MAX_ESCAPES];
+        unsigned char ranges[ACCEL_MAX_RANGES][2]; /* inclusive */
+};
+
+extern const struct accel ACCEL[STATE_COUNT];
+
+/*
+ * first byte in [p, end) that leaves the state of a, end if there is none.
+ * uses avx2 when the cpu has it, sse2 or a scalar loop if not
+ */
+const unsigned char *accel_skip(const unsigned char *p,
+                                const unsigned char *end,
+                                const struct accel *a);
+)";
+  if (comb) {
+    headerFile << "\n#define TABLE_ENCODING_COMB\n";
+    headerFile << "#define COMB_SIZE " << comb->nxt.size() << "\n\n";
+    headerFile << "extern const " << baseType << " COMB_BASE[STATE_COUNT];\n";
+    headerFile << "extern const state_id_t COMB_DEF[STATE_COUNT];\n";
+    headerFile << "extern const state_id_t COMB_NXT[COMB_SIZE];\n";
+    headerFile << "extern const state_id_t COMB_CHK[COMB_SIZE];\n\n";
+    headerFile << "/* next state on column cls, NO_STATE if there is none */\n";
+    headerFile << "static inline int table_next(int state, int cls)\n";
+    headerFile << "{\n";
+    headerFile << "        int slot = COMB_BASE[state] + cls;\n";
+    headerFile << "        if (COMB_CHK[slot] != state) {\n";
+    headerFile << "                state = COMB_DEF[state];\n";
+    headerFile << "                if (state == NO_STATE)\n";
+    headerFile << "                        return NO_STATE;\n";
+    headerFile << "                slot = COMB_BASE[state] + cls;\n";
+    headerFile << "                if (COMB_CHK[slot] != state)\n";
+    headerFile << "                        return NO_STATE;\n";
+    headerFile << "        }\n";
+    headerFile << "        return COMB_NXT[slot];\n";
+    headerFile << "}\n\n";
+  } else if (encoding == TableEncoding::DIRECT) {
+    headerFile << "\n#define TABLE_ENCODING_DIRECT\n\n";
+    headerFile << "/*\n";
+    headerFile << " * longest prefix of src[0, len) accepted by the DFA. "
+                  "returns its length\n";
+    headerFile << " * and stores its accepting state in *accept_state, or "
+                  "returns 0 and\n";
+    headerFile << " * stores -1 if no prefix is accepted\n";
+    headerFile << " */\n";
+    headerFile << "size_t dfa_match(const char *src, size_t len, "
+                  "int *accept_state);\n\n";
+  } else if (encoding == TableEncoding::PACKED) {
+    headerFile << "\n#define TABLE_ENCODING_PACKED\n";
+    headerFile << "#define PACKED_ACCEPT " << packedAccept << "u\n\n";
+    headerFile << R"(/*
+ * like the dense table, but an entry that leads to an accepting state also
+ * has PACKED_ACCEPT set, so a scanner learns the next state and whether to
+ * record a match from one load
+ */
+extern const state_id_t TRANSITION_TABLE[STATE_COUNT][SYMBOL_COUNT];
+
+/* next state on column cls, NO_STATE if there is none */
+static inline int table_next(int state, int cls)
+{
+        return TRANSITION_TABLE[state][cls] & (PACKED_ACCEPT - 1);
+}
+
+)";
+  } else {
+    headerFile << "\n#define TABLE_ENCODING_DENSE\n\n";
+    headerFile << "extern const state_id_t "
+                  "TRANSITION_TABLE[STATE_COUNT][SYMBOL_COUNT];\n\n";
+    headerFile << "/* next state on column cls, NO_STATE if there is none */\n";
+    headerFile << "static inline int table_next(int state, int cls)\n";
+    headerFile << "{\n";
+    headerFile << "        return TRANSITION_TABLE[state][cls];\n";
+    headerFile << "}\n\n";
+  }
   headerFile << "#define START_STATE_ID " << table.startStateId << "\n\n";
   headerFile << "extern const int ACCEPT_STATE_IDS[STATE_COUNT];\n\n";
   headerFile << "typedef enum {\n";
-  // build deterministic token type id map
-  std::map<std::string, int> tokenTypeIds;
-  int tokenCounter = 0;
-  for (const auto &p : table.stateTokenTypes) {
-    const std::string &tt = p.second;
-    if (tokenTypeIds.find(tt) == tokenTypeIds.end())
-      tokenTypeIds[tt] = tokenCounter++;
-  }
   for (const auto &pair : tokenTypeIds) {
-    // sanitize token enum names to be valid C identifiers
-    std::string sanitized;
-    for (size_t i = 0; i < pair.first.size(); ++i) {
-      char ch = pair.first[i];
-      if ((i == 0 && std::isalpha((unsigned char)ch)) ||
-          (i > 0 && (std::isalnum((unsigned char)ch) || ch == '_')))
-        sanitized.push_back(ch);
-      else if (ch == ' ' || ch == '-' || ch == '.')
-        sanitized.push_back('_');
-      else
-        sanitized.push_back('_');
-    }
-    if (sanitized.empty() || !std::isalpha((unsigned char)sanitized[0]))
-      sanitized = "T_" + sanitized;
-
-    headerFile << "  " << sanitized << " = " << pair.second << ",\n";
+    headerFile << "        " << sanitizeIdentifier(pair.first) << " = "
+               << pair.second << ",\n";
   }
-  headerFile << "  TOKEN_TYPE_COUNT = " << tokenCounter << "\n";
+  headerFile << "        UNKNOWN = INT_MAX,\n";
+  headerFile << "        TOKEN_TYPE_COUNT = " << tokenCounter << "\n";
   headerFile << "} TokenType;\n\n";
   headerFile << "extern const int STATE_TOKEN_TYPE[STATE_COUNT];\n\n";
+  headerFile << "char *tok_type_to_str(TokenType type);\n\n";
+  if (!keywords.empty()) {
+    headerFile << "#define TABLE_KEYWORDS\n";
+    headerFile << "#define KEYWORD_COUNT " << keywords.size() << "\n";
+    headerFile << "#define KEYWORD_SLOTS " << keywords.slots.size() << "\n";
+    headerFile << "#define KEYWORD_SEED " << keywords.seed << "u\n";
+    headerFile << "#define KEYWORD_SHIFT " << keywords.shift << "\n";
+    headerFile << "#define KEYWORD_MIN_LENGTH " << keywords.minLength << "\n";
+    headerFile << "#define KEYWORD_MAX_LENGTH " << keywords.maxLength
+               << "\n\n";
+    headerFile << R"(/*
+ * keywords are not part of the DFA, which matches them as the catch-all
+ * pattern they fall under. returns the keyword type of text[0, len) if it is
+ * a keyword of the matched type, type otherwise
+ */
+TokenType keyword_type(TokenType type, const char *text, size_t len);
+
+)";
+  }
   headerFile << "#endif // TRANSITION_TABLE_H\n";
 
   std::ofstream outFile(filename + ".c");
@@ -383,113 +1526,163 @@ void TransitionTableGenerator::generateToFile(const std::string &filename)
     throw std::runtime_error("Failed to open file for writing: " + filename);
   }
 
-  // helper to produce a C char literal with escapes
-  auto escapeChar = [](char c) -> std::string {
-    switch (c) {
-      case '\n':
-        return "\\n";
-      case '\r':
-        return "\\r";
-      case '\t':
-        return "\\t";
-      case '\\':
-        return "\\\\";
-      case '\'':
-        return "\\'";
-      case '\"':
-        return "\\\"";
-      default:
-        if (std::isprint(static_cast<unsigned char>(c)))
-          return std::string(1, c);
-        char buf[5];
-        std::snprintf(
-            buf, sizeof(buf), "\\x%02X", static_cast<unsigned char>(c));
-        return std::string(buf);
-    }
-  };
-
-  // sanitize token enum names to be valid C identifiers
-  auto sanitize = [](const std::string &s) -> std::string {
-    std::string out;
-    for (size_t i = 0; i < s.size(); ++i) {
-      char ch = s[i];
-      if ((i == 0 && std::isalpha((unsigned char)ch)) ||
-          (i > 0 && (std::isalnum((unsigned char)ch) || ch == '_')))
-        out.push_back(ch);
-      else if (ch == ' ' || ch == '-' || ch == '.')
-        out.push_back('_');
-      else
-        out.push_back('_');
-    }
-    if (out.empty() || !std::isalpha((unsigned char)out[0]))
-      out = "T_" + out;
-    return out;
-  };
+  std::vector<std::string> items;
 
   outFile << "/* Generated transition table */\n\n";
   outFile << "#include <stddef.h>\n";
+  outFile << "#include <string.h>\n";
   outFile << "#include \"" << filename << ".h\"\n\n";
+  outFile << "#ifdef __SSE2__\n";
+  outFile << "#include <immintrin.h>\n";
+  outFile << "#ifdef __GNUC__\n";
+  outFile << "#define ACCEL_HAVE_AVX2\n";
+  outFile << "#endif\n";
+  outFile << "#endif\n\n";
 
   // symbol array
-  outFile << "const char ALPHABET[SYMBOL_COUNT] = { ";
-  for (size_t i = 0; i < table.alphabet.size(); ++i) {
-    outFile << "'" << escapeChar(table.alphabet[i]) << "'";
-    if (i + 1 < table.alphabet.size())
-      outFile << ", ";
-  }
-  outFile << " };\n\n";
-
-  // symbolToId as array mapping char -> id (use -1 for not in alphabet)
-  outFile << "const int SYMBOL_TO_ID[256] = {";
-  for (int ch = 0; ch < 256; ++ch) {
-    auto it = table.symbolToId.find(static_cast<char>(ch));
-    if (it != table.symbolToId.end())
-      outFile << it->second;
-    else
-      outFile << -1;
-    if (ch != 255)
-      outFile << ", ";
+  outFile << "const char ALPHABET[SYMBOL_COUNT] = {\n        ";
+  for (char c : table.alphabet)
+    items.push_back("'" + escapeChar(c) + "'");
+  writeCInitializer(outFile, items);
+  outFile << "\n};\n\n";
+
+  // columnOf as array mapping byte -> column (byte class)
+  outFile << "const unsigned char SYMBOL_TO_ID[256] = {\n        ";
+  items.clear();
+  for (int ch = 0; ch < 256; ++ch)
+    items.push_back(std::to_string(table.columnOf[ch]));
+  writeCInitializer(outFile, items);
+  outFile << "\n};\n\n";
+
+  if (comb) {
+    outFile << "const " << baseType << " COMB_BASE[STATE_COUNT] = {\n        ";
+    items.clear();
+    for (int b : comb->base)
+      items.push_back(std::to_string(b));
+    writeCInitializer(outFile, items);
+    outFile << "\n};\n\n";
+
+    outFile << "const state_id_t COMB_DEF[STATE_COUNT] = {\n        ";
+    items.clear();
+    for (int d : comb->def)
+      items.push_back(stateId(d));
+    writeCInitializer(outFile, items);
+    outFile << "\n};\n\n";
+
+    outFile << "const state_id_t COMB_NXT[COMB_SIZE] = {\n        ";
+    items.clear();
+    for (int n : comb->nxt)
+      items.push_back(stateId(n));
+    writeCInitializer(outFile, items);
+    outFile << "\n};\n\n";
+
+    outFile << "const state_id_t COMB_CHK[COMB_SIZE] = {\n        ";
+    items.clear();
+    for (int c : comb->chk)
+      items.push_back(stateId(c));
+    writeCInitializer(outFile, items);
+    outFile << "\n};\n\n";
+  } else if (encoding == TableEncoding::DIRECT) {
+    writeDirectScanner(outFile, table);
+  } else {
+    // transition table (STATE_COUNT x SYMBOL_COUNT), dense or packed
+    outFile << "const state_id_t TRANSITION_TABLE[STATE_COUNT][SYMBOL_COUNT] "
+               "= {\n";
+    for (int r = 0; r < stateCount; ++r) {
+      items.clear();
+      for (int c = 0; c < symbolCount; ++c) {
+        int to = table.at(r, c);
+        items.push_back(to != -1 && packedAccept && table.isAccept(to)
+                            ? std::to_string(to | packedAccept)
+                            : stateId(to));
+      }
+      outFile << "        { ";
+      writeCInitializer(outFile, items, 10);
+      outFile << " }" << (r + 1 < stateCount ? "," : "") << "\n";
+    }
+    outFile << "};\n\n";
   }
-  outFile << " };\n\n";
 
-  // transition table (STATE_COUNT x SYMBOL_COUNT)
-  outFile << "const int TRANSITION_TABLE[STATE_COUNT][SYMBOL_COUNT] = {\n";
-  for (int r = 0; r < stateCount; ++r) {
-    outFile << "  { ";
-    for (int c = 0; c < symbolCount; ++c) {
-      outFile << table.table[r][c];
-      if (c + 1 < symbolCount)
-        outFile << ", ";
-    }
-    outFile << " }";
-    if (r + 1 < stateCount)
-      outFile << ",";
-    outFile << "\n";
+  writeAccelerators(outFile, table);
+
+  // token type names, used when printing the symbol table
+  outFile << "char *tok_type_to_str(TokenType type)\n";
+  outFile << "{\n";
+  outFile << "        switch (type) {\n";
+  for (const auto &pair : tokenTypeIds) {
+    std::string name = sanitizeIdentifier(pair.first);
+    outFile << "        case " << name << ":\n";
+    outFile << "                return \"" << name << "\";\n";
   }
-  outFile << "};\n\n";
+  outFile << "        case UNKNOWN:\n";
+  outFile << "                return \"UNKNOWN\";\n";
+  outFile << "        default:\n";
+  outFile << "                return \"UNKNOWN\";\n";
+  outFile << "        }\n";
+  outFile << "}\n\n";
 
   // accept states: boolean array per state
-  outFile << "const int ACCEPT_STATE_IDS[STATE_COUNT] = { ";
-  for (int s = 0; s < stateCount; ++s) {
-    outFile << (table.acceptStateIds.count(s) ? 1 : 0);
-    if (s + 1 < stateCount)
-      outFile << ", ";
-  }
-  outFile << " };\n\n";
+  outFile << "const int ACCEPT_STATE_IDS[STATE_COUNT] = {\n        ";
+  items.clear();
+  for (int s = 0; s < stateCount; ++s)
+    items.push_back(table.isAccept(s) ? "1" : "0");
+  writeCInitializer(outFile, items);
+  outFile << "\n};\n\n";
 
   // state -> token mapping (-1 for none)
-  outFile << "const int STATE_TOKEN_TYPE[STATE_COUNT] = { ";
-  for (int s = 0; s < stateCount; ++s) {
-    auto it = table.stateTokenTypes.find(s);
-    if (it != table.stateTokenTypes.end())
-      outFile << tokenTypeIds[it->second];
-    else
-      outFile << -1;
-    if (s + 1 < stateCount)
-      outFile << ", ";
+  outFile << "const int STATE_TOKEN_TYPE[STATE_COUNT] = {\n        ";
+  items.clear();
+  for (int s = 0; s < stateCount; ++s)
+    items.push_back(std::to_string(table.states[s].token));
+  writeCInitializer(outFile, items);
+  outFile << "\n};\n";
+
+  if (!keywords.empty()) {
+    // perfect hash, see KeywordTable
+    outFile << "\nstatic const struct keyword {\n";
+    outFile << "        const char *text;\n";
+    outFile << "        size_t len;\n";
+    outFile << "        TokenType host;\n";
+    outFile << "        TokenType type;\n";
+    outFile << "} KEYWORDS[KEYWORD_SLOTS] = {\n";
+    for (size_t i = 0; i < keywords.slots.size(); i++) {
+      const KeywordTable::Keyword &slot = keywords.slots[i];
+      if (slot.text.empty())
+        continue;
+      // a hex escape would run on into a following hex digit
+      std::string text;
+      for (size_t j = 0; j < slot.text.size(); j++) {
+        std::string escaped = escapeChar(slot.text[j]);
+        text += escaped;
+        if (escaped[1] == 'x' && j + 1 < slot.text.size() &&
+            std::isxdigit(static_cast<unsigned char>(slot.text[j + 1])))
+          text += "\"\"";
+      }
+      outFile << "        [" << i << "] = { \"" << text << "\", "
+              << slot.text.size() << ", "
+              << sanitizeIdentifier(slot.hostType) << ", "
+              << sanitizeIdentifier(slot.tokenType) << " },\n";
+    }
+    outFile << "};\n\n";
+    outFile << R"(TokenType keyword_type(TokenType type, const char *text, size_t len)
+{
+        const unsigned char *p = (const unsigned char *)text;
+        const struct keyword *k;
+        uint32_t key;
+
+        if (len < KEYWORD_MIN_LENGTH || len > KEYWORD_MAX_LENGTH)
+                return type;
+        key = p[0] | p[len / 2] << 8 | (uint32_t)p[len - 1] << 16 |
+              (uint32_t)len << 24;
+        k = &KEYWORDS[key * KEYWORD_SEED >> KEYWORD_SHIFT];
+        if (k->len == len && k->host == type &&
+            memcmp(k->text, text, len) == 0)
+                return k->type;
+        return type;
+}
+)";
   }
-  outFile << " };\n";
 
   headerFile.close();
   outFile.close();
-}
\ No newline at end of file
+}
@@ -1,28 +1,23 @@
 #ifndef DFA_H
 #define DFA_H
 
+#include <algorithm>
+#include <array>
 #include <map>
+#include <optional>
 #include <set>
+#include <string_view>
+#include <unordered_map>
 #include "./nfa.hpp"
 
 class DFAState
 {
 public:
   int id;
-  std::set<NFAState *> nfaStates;
   bool isAccept;
   std::optional<std::string> tokenType; // for lexer use
 
-  DFAState(int id, const std::set<NFAState *> &states)
-      : id(id), nfaStates(states), isAccept(false)
-  {
-    for (NFAState *nfaState : states) {
-      if (nfaState->tokenType) {
-        tokenType = nfaState->tokenType;
-        break;
-      }
-    }
-  }
+  DFAState(int id) : id(id), isAccept(false) {}
 };
 
 class DFATransition
@@ -30,9 +25,9 @@ class DFATransition
 public:
   DFAState *from;
   DFAState *to;
-  char symbol;
+  int symbol; // byte class id, see DFA::classes
 
-  DFATransition(DFAState *f, DFAState *t, char symb)
+  DFATransition(DFAState *f, DFAState *t, int symb)
       : from(f), to(t), symbol(symb)
   {
   }
@@ -55,12 +50,13 @@ public:
   std::vector<DFATransition> transitions;
   DFAState *startState;
   std::set<DFAState *> acceptStates;
+  ByteClasses classes; // maps input bytes to transition symbols
 
   DFA() : startState(nullptr) {}
 
-  DFAState *createState(const std::set<NFAState *> &nfaStates);
+  DFAState *createState();
 
-  void addTransition(DFAState *f, DFAState *t, char symb);
+  void addTransition(DFAState *f, DFAState *t, int symb);
 
   std::vector<DFATransition *> getTransitions(DFAState *state);
 
@@ -76,29 +72,268 @@ class SubsetConstruction
 public:
   NFA &nfa;
   DFA dfa;
-  std::map<std::set<NFAState *>, DFAState *> stateMapping;
+  ByteClasses classes;
+  // interned nfa state sets, each distinct set is stored once as a key
+  std::unordered_map<StateSet, DFAState *, StateSetHash> stateMapping;
+  // nfa state set of each dfa state indexed by DFAState::id, points into the
+  // keys of stateMapping
+  std::vector<const StateSet *> dfaStateSets;
 
-  SubsetConstruction(NFA &n) : nfa(n) {}
+  SubsetConstruction(NFA &n) : nfa(n), classes(n.getByteClasses()) {}
+  SubsetConstruction(NFA &n, const ByteClasses &bc) : nfa(n), classes(bc) {}
 
   DFA convert();
   DFA getDFA();
+
+private:
+  DFAState *createDFAState(StateSet &&nfaStates);
+};
+
+// merges equivalent DFA states. the initial partition separates states by
+// the token type they accept so that minimization never merges two tokens
+class HopcroftMinimization
+{
+private:
+  DFA &dfa;
+
+public:
+  HopcroftMinimization(DFA &d) : dfa(d) {}
+
+  DFA minimize();
+};
+
+// skip accelerator of a state that goes back to itself on most bytes. an
+// ESCAPES state loops on every byte except a few escape bytes, like the
+// inside of a comment or a string. a RANGES state loops on the bytes in a
+// few ranges, like the rest of an identifier or a run of whitespace. the
+// lexer jumps straight to the first byte that leaves the state instead of
+// stepping through the table one byte at a time
+struct Accelerator {
+  static constexpr size_t MAX_ESCAPES = 3;
+  static constexpr size_t MAX_RANGES = 4;
+  // loops a state takes on itself before the lexer uses its accelerator.
+  // most runs are a few bytes long, and stepping those through the table is
+  // cheaper than setting up a skip
+  static constexpr size_t MIN_RUN = 4;
+
+  enum Kind { NONE, ESCAPES, RANGES };
+
+  Kind kind;
+  bool high; // ESCAPES: every byte >= 0x80 escapes as well, negated classes
+  std::string escapes; // ESCAPES: at most MAX_ESCAPES bytes below 0x80
+  // RANGES: at most MAX_RANGES inclusive ranges of bytes that loop
+  std::vector<std::pair<unsigned char, unsigned char>> ranges;
+  std::array<bool, 256> stops; // bytes that leave the state
+
+  Accelerator() : kind(NONE), high(false), stops{} {}
+
+  bool enabled() const { return kind != NONE; }
+
+  // number of bytes at the front of text before the first byte that leaves
+  // the state. uses AVX2 when the cpu has it, SSE2 or a scalar loop if not
+  size_t skip(const char *text, size_t size) const;
 };
 
+// accelerator of state, given its next state on every byte. NONE when the
+// state fits neither kind
+Accelerator findAccelerator(int state, const int next[256]);
+
+// dense table in one row-major block, so a step is a byte-to-column lookup
+// and one load from the current state's row. state info is kept in a
+// separate array that is only read on the states a match passes through
 class TransitionTable
 {
 public:
-  std::vector<std::vector<int>> table;
-  std::vector<char> alphabet;
-  std::map<char, int> symbolToId;
+  // per state, token indexes tokenNames and is -1 if the state has none
+  struct StateInfo {
+    bool accept;
+    int token;
+  };
+
+  // entry state * columnCount() + column is the next state, -1 for none
+  std::vector<int> transitions;
+  std::vector<char> alphabet; // representative byte of each column
+  std::array<uint8_t, 256> columnOf; // every byte to its column (byte class)
   int startStateId;
-  std::set<int> acceptStateIds;
-  std::map<int, std::string> stateTokenTypes;
+  std::vector<StateInfo> states;
+  // in order of the first accepting state with each type
+  std::vector<std::string> tokenNames;
+  std::vector<Accelerator> accelerators; // per state
+
+  TransitionTable() : columnOf(), startStateId(-1) {}
 
-  TransitionTable() : startStateId(-1) {}
+  size_t stateCount() const { return states.size(); }
+  size_t columnCount() const { return alphabet.size(); }
+  int at(int state, int column) const
+  {
+    return transitions[state * alphabet.size() + column];
+  }
 
   MatchResult matches(const std::string &str);
+
+  // stepping interface shared with LazyDFA, used by TableDrivenLexer
+  int start() const { return startStateId; }
+  int next(int state, char c) const
+  {
+    return at(state, columnOf[static_cast<unsigned char>(c)]);
+  }
+  bool isAccept(int state) const { return states[state].accept; }
+  const std::string &tokenType(int state) const;
+
+  // optional part of the stepping interface: how many bytes at the front of
+  // text leave state where it is, 0 unless the state is accelerated
+  size_t skip(int state, const char *text, size_t size) const
+  {
+    const Accelerator &accelerator = accelerators[state];
+    return accelerator.enabled() ? accelerator.skip(text, size) : 0;
+  }
 };
 
+// comb compressed TransitionTable, laid out like flex's base/def/nxt/chk
+// arrays. the entry of state s for column c is nxt[base[s] + c] when
+// chk[base[s] + c] == s. a state whose row is close to the row of an earlier
+// state only stores the columns where they differ and falls back to that
+// state, def[s], for the rest. defaults are never chained, so a lookup
+// probes at most two slots
+class CombTable
+{
+public:
+  std::vector<int> base;
+  std::vector<int> def; // -1 if the state has no default
+  std::vector<int> nxt; // -1 for a missing transition
+  std::vector<int> chk; // state owning the slot, -1 if unused
+  std::vector<uint8_t> classOf; // byte -> column
+  std::vector<int> stateTokens; // index into tokenNames, -1 if not accepting
+  std::vector<std::string> tokenNames;
+  std::vector<Accelerator> accelerators;
+  int startStateId;
+
+  CombTable(const TransitionTable &table);
+
+  // stepping interface shared with TransitionTable, used by TableDrivenLexer
+  size_t stateCount() const { return base.size(); }
+  int start() const { return startStateId; }
+  int next(int state, char c) const
+  {
+    int column = classOf[static_cast<unsigned char>(c)];
+    int slot = base[state] + column;
+    if (chk[slot] != state) {
+      state = def[state];
+      if (state == -1)
+        return -1;
+      slot = base[state] + column;
+      if (chk[slot] != state)
+        return -1;
+    }
+    return nxt[slot];
+  }
+  bool isAccept(int state) const { return stateTokens[state] != -1; }
+  const std::string &tokenType(int state) const
+  {
+    return tokenNames[stateTokens[state]];
+  }
+  size_t skip(int state, const char *text, size_t size) const
+  {
+    const Accelerator &accelerator = accelerators[state];
+    return accelerator.enabled() ? accelerator.skip(text, size) : 0;
+  }
+};
+
+// text of a pattern with no operators or classes, like "while" or "==".
+// nullopt for any other pattern
+std::optional<std::string> literalText(const std::string &pattern);
+
+// keywords left out of the DFA, looked up in a perfect hash once the token
+// of a catch-all pattern like IDENTIFIER has been matched. like gperf the
+// hash only reads a few bytes of the token: its first, middle and last byte
+// and its length make a key, and the top bits of key * seed pick the slot.
+// seed is picked so that no two keywords share a slot, keywords that share
+// their key can't be told apart and are left to the DFA
+class KeywordTable
+{
+public:
+  struct Keyword {
+    std::string text;
+    std::string hostType; // type the DFA gives text without the keyword
+    std::string tokenType;
+  };
+
+  std::vector<Keyword> slots; // power of two, text is empty if unused
+  uint32_t seed;
+  int shift; // 32 - log2 of the slot count
+  size_t minLength;
+  size_t maxLength;
+
+  KeywordTable() : seed(0), shift(0), minLength(0), maxLength(0) {}
+  KeywordTable(const std::vector<Keyword> &keywords);
+
+  // literal patterns that automaton resolves to a pattern of a different
+  // token type, all of whose patterns have a lower priority. the DFA
+  // accepts the same lengths with or without such a literal, only the type
+  // of its exact text changes
+  template <typename Automaton>
+  static KeywordTable find(const std::vector<RegexPattern> &patterns,
+                           const Automaton &automaton);
+
+  static uint32_t key(const char *text, size_t size)
+  {
+    const unsigned char *bytes = reinterpret_cast<const unsigned char *>(text);
+    return bytes[0] | bytes[size / 2] << 8 | bytes[size - 1] << 16 |
+        static_cast<uint32_t>(size) << 24;
+  }
+
+  bool empty() const { return slots.empty(); }
+  size_t size() const;
+
+  // keyword with the given text, nullptr if there is none
+  const Keyword *lookup(std::string_view text) const
+  {
+    if (slots.empty() || text.size() < minLength || text.size() > maxLength)
+      return nullptr;
+    const Keyword &slot = slots[key(text.data(), text.size()) * seed >> shift];
+    return slot.text == text ? &slot : nullptr;
+  }
+};
+
+template <typename Automaton>
+KeywordTable KeywordTable::find(const std::vector<RegexPattern> &patterns,
+                                const Automaton &automaton)
+{
+  std::map<std::string, int> typePriority; // best priority of each type
+  for (const auto &pattern : patterns) {
+    auto it = typePriority.emplace(pattern.tokenType, pattern.priority).first;
+    it->second = std::min(it->second, pattern.priority);
+  }
+
+  // when literals share their text the one with the best priority wins
+  std::map<std::string, std::pair<int, Keyword>> found;
+  for (const auto &pattern : patterns) {
+    std::optional<std::string> text = literalText(pattern.pattern);
+    if (!text || text->empty())
+      continue;
+
+    int state = automaton.start();
+    for (size_t i = 0; i < text->size() && state != -1; i++)
+      state = automaton.next(state, (*text)[i]);
+    if (state == -1 || !automaton.isAccept(state))
+      continue;
+
+    const std::string &host = automaton.tokenType(state);
+    if (host == pattern.tokenType || typePriority[host] <= pattern.priority)
+      continue;
+
+    auto it = found.find(*text);
+    if (it == found.end() || pattern.priority < it->second.first)
+      found[*text] = { pattern.priority,
+                       Keyword{ *text, host, pattern.tokenType } };
+  }
+
+  std::vector<Keyword> keywords;
+  for (auto &entry : found)
+    keywords.push_back(std::move(entry.second.second));
+  return KeywordTable(keywords);
+}
+
 class TransitionTableBuilder
 {
 private:
@@ -110,17 +345,63 @@ public:
   TransitionTable build();
 };
 
+// how TransitionTableGenerator builds the DFA, both give identical tables
+enum class Construction {
+  THOMPSON_SUBSET, // thompson nfa followed by subset construction
+  FOLLOWPOS, // position automaton built directly from the regex ASTs
+};
+
+// how the generated C file encodes the DFA. the tables use the narrowest
+// unsigned state id type that fits STATE_COUNT
+enum class TableEncoding {
+  DENSE, // STATE_COUNT x SYMBOL_COUNT array
+  COMB, // see CombTable
+  DIRECT, // no table, dfa_match() is emitted as goto code, one label a state
+  PACKED, // DENSE with the accept flag of the next state in every entry
+};
+
+// how the generated lexer tells keywords from identifiers
+enum class KeywordMode {
+  DFA, // every pattern is part of the DFA
+  HASH, // literals a catch-all also matches are moved to a KeywordTable
+};
+
 class TransitionTableGenerator
 {
 private:
   std::vector<RegexPattern> patterns;
+  Construction construction;
+  TableEncoding encoding;
+  KeywordMode keywordMode;
+  KeywordTable keywords; // of the last generate()
+
+  // parses every pattern and refines classes with the resulting ASTs
+  std::vector<std::shared_ptr<ASTNode>>
+  parsePatterns(const std::vector<RegexPattern> &pats, ByteClasses &classes);
+  NFA buildThompsonNFA(const std::vector<RegexPattern> &pats,
+                       const std::vector<std::shared_ptr<ASTNode>> &roots);
+  TransitionTable build(const std::vector<RegexPattern> &pats);
 
 public:
-  TransitionTableGenerator(const std::vector<RegexPattern> &pats)
-      : patterns(pats)
+  TransitionTableGenerator(
+      const std::vector<RegexPattern> &pats,
+      Construction cons = Construction::THOMPSON_SUBSET)
+      : patterns(pats), construction(cons), encoding(TableEncoding::DENSE),
+        keywordMode(KeywordMode::DFA)
   {
   }
 
+  void setConstruction(Construction cons) { construction = cons; }
+  void setEncoding(TableEncoding enc) { encoding = enc; }
+  void setKeywordMode(KeywordMode mode) { keywordMode = mode; }
+
+  // keywords generate() left out of the table, empty unless the mode is HASH
+  const KeywordTable &keywordTable() const { return keywords; }
+
+  // combined thompson nfa of all patterns with closures precomputed, used
+  // by LazyDFA to skip building the full table
+  NFA buildNFA();
+
   TransitionTable generate();
   void generateToFile(const std::string &filename);
 };
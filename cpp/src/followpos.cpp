@@ -0,0 +1,207 @@
+#include "./followpos.hpp"
+#include <iostream>
+#include <queue>
+#include <stdexcept>
+
+int FollowposConstruction::countPositions(const std::shared_ptr<ASTNode> &node)
+{
+  if (!node) {
+    throw std::runtime_error("Null ASTNode");
+  }
+
+  if (node->type == NodeType::CHAR || node->type == NodeType::CHAR_CLASS)
+    return 1;
+
+  int count = countPositions(node->left);
+  if (node->type == NodeType::CONCAT || node->type == NodeType::UNION)
+    count += countPositions(node->right);
+  return count;
+}
+
+void FollowposConstruction::addFollow(const StateSet &from, const StateSet &to)
+{
+  from.forEach([&](int p) { followpos[p].unionWith(to); });
+}
+
+FollowposConstruction::NodeInfo
+FollowposConstruction::analyze(const std::shared_ptr<ASTNode> &node)
+{
+  size_t total = followpos.size();
+  NodeInfo info{ false, StateSet(total), StateSet(total) };
+  NodeInfo left{ false, StateSet(), StateSet() };
+  NodeInfo right{ false, StateSet(), StateSet() };
+
+  switch (node->type) {
+    case NodeType::CHAR:
+    case NodeType::CHAR_CLASS: {
+      Position position{ false, std::vector<bool>(classes.count(), false), -1 };
+      if (node->type == NodeType::CHAR) {
+        position.matches[classes.classOf[(unsigned char)node->value]] = true;
+      } else {
+        for (char c : node->charClass)
+          position.matches[classes.classOf[(unsigned char)c]] = true;
+      }
+
+      int id = positions.size();
+      positions.push_back(std::move(position));
+      info.firstpos.insert(id);
+      info.lastpos.insert(id);
+      return info;
+    }
+
+    case NodeType::CONCAT:
+      left = analyze(node->left);
+      right = analyze(node->right);
+      addFollow(left.lastpos, right.firstpos);
+
+      info.nullable = left.nullable && right.nullable;
+      info.firstpos = left.firstpos;
+      if (left.nullable)
+        info.firstpos.unionWith(right.firstpos);
+      info.lastpos = right.lastpos;
+      if (right.nullable)
+        info.lastpos.unionWith(left.lastpos);
+      return info;
+
+    case NodeType::UNION:
+      left = analyze(node->left);
+      right = analyze(node->right);
+
+      info.nullable = left.nullable || right.nullable;
+      info.firstpos = left.firstpos;
+      info.firstpos.unionWith(right.firstpos);
+      info.lastpos = left.lastpos;
+      info.lastpos.unionWith(right.lastpos);
+      return info;
+
+    case NodeType::STAR:
+    case NodeType::PLUS:
+      left = analyze(node->left);
+      addFollow(left.lastpos, left.firstpos);
+
+      info.nullable = node->type == NodeType::STAR || left.nullable;
+      info.firstpos = left.firstpos;
+      info.lastpos = left.lastpos;
+      return info;
+
+    case NodeType::QUESTION:
+      left = analyze(node->left);
+
+      info.nullable = true;
+      info.firstpos = left.firstpos;
+      info.lastpos = left.lastpos;
+      return info;
+  }
+
+  throw std::runtime_error("Unknown node type");
+}
+
+DFA FollowposConstruction::convert()
+{
+  std::cout << "Starting followpos construction..." << std::endl;
+
+  if (roots.size() != patterns.size()) {
+    throw std::runtime_error("Pattern and AST counts differ");
+  }
+
+  // one position per leaf plus one end marker per pattern
+  size_t total = 0;
+  for (const auto &root : roots)
+    total += countPositions(root) + 1;
+
+  positions.clear();
+  positions.reserve(total);
+  followpos.assign(total, StateSet(total));
+
+  StateSet startPositions(total);
+  for (size_t k = 0; k < roots.size(); k++) {
+    NodeInfo info = analyze(roots[k]);
+
+    int end = positions.size();
+    positions.push_back(Position{ true, {}, static_cast<int>(k) });
+
+    StateSet endSet(total);
+    endSet.insert(end);
+    addFollow(info.lastpos, endSet);
+
+    startPositions.unionWith(info.firstpos);
+    if (info.nullable)
+      startPositions.insert(end);
+  }
+
+  // leaf positions that match each byte class
+  std::vector<StateSet> classPositions(classes.count(), StateSet(total));
+  for (size_t p = 0; p < positions.size(); p++) {
+    for (int c = 0; c < classes.count() && !positions[p].isEnd; c++) {
+      if (positions[p].matches[c])
+        classPositions[c].insert(p);
+    }
+  }
+
+  DFA dfa;
+  dfa.classes = classes;
+  std::unordered_map<StateSet, DFAState *, StateSetHash> stateMapping;
+  std::vector<const StateSet *> dfaStateSets;
+  std::queue<int> workQueue;
+
+  auto createDFAState = [&](StateSet &&set) {
+    DFAState *state = dfa.createState();
+    auto it = stateMapping.emplace(std::move(set), state).first;
+    dfaStateSets.push_back(&it->first);
+    workQueue.push(state->id);
+
+    // same resolution as subset construction: lowest priority value wins,
+    // patterns with INT_MAX fall back to the first pattern in the set
+    int bestPriority = INT_MAX;
+    it->first.forEach([&](int p) {
+      if (!positions[p].isEnd)
+        return;
+      const RegexPattern &pattern = patterns[positions[p].pattern];
+      if (!state->tokenType)
+        state->tokenType = pattern.tokenType;
+      if (pattern.priority < bestPriority) {
+        state->tokenType = pattern.tokenType;
+        bestPriority = pattern.priority;
+      }
+      state->isAccept = true;
+    });
+
+    if (state->isAccept)
+      dfa.acceptStates.insert(state);
+    return state;
+  };
+
+  dfa.startState = createDFAState(std::move(startPositions));
+
+  while (!workQueue.empty()) {
+    int currentId = workQueue.front();
+    workQueue.pop();
+
+    const StateSet &current = *dfaStateSets[currentId];
+    DFAState *currentDFAState = dfa.states[currentId].get();
+
+    for (int symbol = 0; symbol < classes.count(); symbol++) {
+      StateSet next(total);
+      current.forEach([&](int p) {
+        if (classPositions[symbol].contains(p))
+          next.unionWith(followpos[p]);
+      });
+
+      if (next.empty())
+        continue;
+
+      DFAState *nextDFAState;
+      auto it = stateMapping.find(next);
+      if (it == stateMapping.end())
+        nextDFAState = createDFAState(std::move(next));
+      else
+        nextDFAState = it->second;
+
+      dfa.addTransition(currentDFAState, nextDFAState, symbol);
+    }
+  }
+
+  std::cout << "Followpos construction complete with " << dfa.states.size()
+            << " states" << std::endl;
+  return dfa;
+}
@@ -0,0 +1,49 @@
+#ifndef FOLLOWPOS_HPP
+#define FOLLOWPOS_HPP
+
+#include "./dfa.hpp"
+
+// builds a DFA directly from the regex ASTs using the followpos (position
+// automaton) construction, without going through Thompson's NFA. every
+// pattern is augmented with an end marker position that carries its token
+// type, accepting DFA states are the ones containing an end marker
+class FollowposConstruction
+{
+private:
+  struct Position {
+    bool isEnd;
+    std::vector<bool> matches; // byte classes matched by a leaf position
+    int pattern; // index of the pattern owning an end marker, else -1
+  };
+
+  struct NodeInfo {
+    bool nullable;
+    StateSet firstpos;
+    StateSet lastpos;
+  };
+
+  const std::vector<std::shared_ptr<ASTNode>> &roots;
+  const std::vector<RegexPattern> &patterns;
+  ByteClasses classes;
+
+  std::vector<Position> positions;
+  std::vector<StateSet> followpos;
+
+  int countPositions(const std::shared_ptr<ASTNode> &node);
+  NodeInfo analyze(const std::shared_ptr<ASTNode> &node);
+  void addFollow(const StateSet &from, const StateSet &to);
+
+public:
+  // roots[i] is the parsed AST of patterns[i]. classes must have been
+  // refined with every root
+  FollowposConstruction(const std::vector<std::shared_ptr<ASTNode>> &roots,
+                        const std::vector<RegexPattern> &patterns,
+                        const ByteClasses &classes)
+      : roots(roots), patterns(patterns), classes(classes)
+  {
+  }
+
+  DFA convert();
+};
+
+#endif
@@ -0,0 +1,85 @@
+#include "./lazy_dfa.hpp"
+#include <stdexcept>
+
+LazyDFA::LazyDFA(NFA &n, size_t budget)
+    : nfa(n), classes(n.getByteClasses()), flushCount(0), builtCount(0),
+      startStateId(-1)
+{
+  if (!nfa.startState) {
+    throw std::runtime_error("NFA has no start states");
+  }
+
+  // a step needs room for the start, the current and the next state
+  stateBudget = budget < 3 ? 3 : budget;
+
+  StateSet startClosure(nfa.stateCount());
+  startClosure.insert(nfa.startState->id);
+  nfa.epsilonClosure(startClosure);
+  startStateId = addState(std::move(startClosure));
+}
+
+// returns the id of the cached state for the set, creating it if needed
+int LazyDFA::addState(StateSet &&nfaStates)
+{
+  auto found = stateMapping.find(nfaStates);
+  if (found != stateMapping.end())
+    return found->second;
+
+  int id = stateSets.size();
+  auto it = stateMapping.emplace(std::move(nfaStates), id).first;
+  stateSets.push_back(&it->first);
+  table.resize(table.size() + classes.count(), UNKNOWN);
+
+  // token type strings live in the nfa states, so the pointers stay valid
+  // across flushes
+  NFAState *accepting = nfa.acceptingState(it->first);
+  tokenTypes.push_back(accepting && accepting->tokenType
+                           ? &*accepting->tokenType
+                           : nullptr);
+
+  builtCount++;
+  return id;
+}
+
+void LazyDFA::flush()
+{
+  stateMapping.clear();
+  stateSets.clear();
+  table.clear();
+  tokenTypes.clear();
+  flushCount++;
+
+  StateSet startClosure(nfa.stateCount());
+  startClosure.insert(nfa.startState->id);
+  nfa.epsilonClosure(startClosure);
+  startStateId = addState(std::move(startClosure));
+}
+
+int LazyDFA::next(int state, char c)
+{
+  int symbol = classes.classOf[static_cast<unsigned char>(c)];
+  int cached = table[state * classes.count() + symbol];
+  if (cached != UNKNOWN)
+    return cached;
+
+  StateSet target = nfa.move(*stateSets[state], c);
+  if (target.empty()) {
+    table[state * classes.count() + symbol] = -1;
+    return -1;
+  }
+  nfa.epsilonClosure(target);
+
+  // out of budget: drop every cached state and carry on from the current
+  // one. ids handed out earlier are invalid after this, callers only keep
+  // the state they pass in and the one returned
+  if (stateSets.size() >= stateBudget &&
+      stateMapping.find(target) == stateMapping.end()) {
+    StateSet current = *stateSets[state];
+    flush();
+    state = addState(std::move(current));
+  }
+
+  int id = addState(std::move(target));
+  table[state * classes.count() + symbol] = id;
+  return id;
+}
@@ -0,0 +1,53 @@
+#ifndef LAZY_DFA_HPP
+#define LAZY_DFA_HPP
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "./nfa.hpp"
+
+// DFA that is determinized on demand while lexing. states are built from the
+// nfa the first time a transition is taken and cached. when the cache holds
+// stateBudget states it is flushed and rebuilt from the current state, so
+// memory stays bounded even for patterns whose full DFA explodes
+class LazyDFA
+{
+private:
+  NFA &nfa;
+  ByteClasses classes;
+  size_t stateBudget;
+  size_t flushCount;
+  size_t builtCount;
+
+  // interned nfa state sets, same scheme as SubsetConstruction
+  std::unordered_map<StateSet, int, StateSetHash> stateMapping;
+  std::vector<const StateSet *> stateSets;
+
+  // row-major transitions, UNKNOWN until the transition is first taken
+  std::vector<int> table;
+  std::vector<const std::string *> tokenTypes; // nullptr if not accepting
+  int startStateId;
+
+  int addState(StateSet &&nfaStates);
+  void flush();
+
+public:
+  static constexpr int UNKNOWN = -2;
+
+  // nfa must have its closures computed and outlive the LazyDFA
+  LazyDFA(NFA &n, size_t budget = 4096);
+
+  int start() const { return startStateId; }
+
+  // next state on byte c, -1 if there is none
+  int next(int state, char c);
+
+  bool isAccept(int state) const { return tokenTypes[state] != nullptr; }
+  const std::string &tokenType(int state) const { return *tokenTypes[state]; }
+
+  size_t cachedStates() const { return stateSets.size(); }
+  size_t statesBuilt() const { return builtCount; }
+  size_t flushes() const { return flushCount; }
+};
+
+#endif
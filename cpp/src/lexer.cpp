@@ -1,102 +1,123 @@
 #include "./lexer.hpp"
+#include <algorithm>
 #include <cstdio>
 #include <fstream>
+#include <iomanip>
 #include <iostream>
 
-void TableDrivenLexer::lex(const std::string &input)
+void TableDrivenLexer::lex(std::string_view input)
 {
-  int startState = transitionTable.startStateId;
-  int currentPos = 0;
-  int tokenStart = 0; // Track where current token started
-
-  while (currentPos <= input.size()) { // Changed to <= to handle last token
-    int currentState = startState;
-    int lastAcceptState = -1;
-    int lastAcceptPos = -1;
-
-    // Try to match longest possible token from current position
-    int pos = tokenStart;
-    while (pos < input.size()) {
-      char c = input[pos];
-
-      // Check if character is in alphabet
-      auto symbolIt = transitionTable.symbolToId.find(c);
-      if (symbolIt == transitionTable.symbolToId.end()) {
-        break;
-      }
-
-      int nextState = transitionTable.table[currentState][symbolIt->second];
-      if (nextState == -1) {
-        break;
-      }
-
-      currentState = nextState;
-      if (transitionTable.acceptStateIds.count(currentState)) {
-        lastAcceptState = currentState;
-        lastAcceptPos = pos;
-      }
-      pos++;
-    }
-
-    // Emit token if we found an accepting state
-    if (lastAcceptState != -1) {
-      int lexemeLength = lastAcceptPos - tokenStart + 1;
-      std::string lexeme = input.substr(tokenStart, lexemeLength);
-      std::string tokenType = transitionTable.stateTokenTypes[lastAcceptState];
-
-      tokens.push_back(LexerToken(lexeme, tokenType));
-
-      if (tokenType != "WHITESPACE") { // Skip whitespace tokens
-        std::cout << "Token: " << tokenType << ", Lexeme: \"" << lexeme << "\""
-                  << std::endl;
-      }
-
-      tokenStart = lastAcceptPos + 1;
-      currentPos = tokenStart;
-    } else {
-      // No valid token found - skip one character
-      if (tokenStart < input.size()) {
-        // add invalid (unknown token) to tokens
-        std::string lexeme(1, input[tokenStart]);
-        std::string tokenType = "UNKNOWN";
-        tokens.emplace_back(lexeme, tokenType);
-
-        std::cerr << "Invalid input at position " << tokenStart << ": '"
-                  << input[tokenStart] << "'" << std::endl;
-        tokenStart++;
-        currentPos = tokenStart;
-      } else {
-        break;
-      }
-    }
+  if (lazyDFA)
+    scan(*lazyDFA, input);
+  else if (tableImage)
+    scan(*tableImage, input);
+  else if (combTable)
+    scan(*combTable, input);
+  else if (transitionTable)
+    scan(*transitionTable, input);
+  else
+    throw std::logic_error("lex() needs a table, use scan()");
+}
+
+void FailedPairs::prune(size_t pos)
+{
+  if (pairs.size() < pruneAt)
+    return;
+  for (auto it = pairs.begin(); it != pairs.end();)
+    it = (*it >> 32) < pos ? pairs.erase(it) : std::next(it);
+  pruneAt = std::max<size_t>(4096, 2 * pairs.size());
+}
+
+uint32_t TableDrivenLexer::kindOf(std::string_view name)
+{
+  auto it = kindIds.find(name);
+  if (it != kindIds.end())
+    return it->second;
+
+  uint32_t kind = kindNames.size();
+  kindNames.emplace_back(name);
+  kindIds.emplace(name, kind);
+  return kind;
+}
+
+void TableDrivenLexer::setKeywords(const KeywordTable &table)
+{
+  keywords = &table;
+  keywordKinds.assign(table.slots.size(), { NO_KIND, NO_KIND });
+  for (size_t slot = 0; slot < table.slots.size(); slot++) {
+    const KeywordTable::Keyword &keyword = table.slots[slot];
+    if (!keyword.text.empty())
+      keywordKinds[slot] = { kindOf(keyword.hostType),
+                             kindOf(keyword.tokenType) };
   }
 }
 
-void TableDrivenLexer::createSymbolTable(const std::string &input,
+uint32_t TableDrivenLexer::keywordKind(uint32_t kind,
+                                       std::string_view lexeme) const
+{
+  const KeywordTable::Keyword *keyword = keywords->lookup(lexeme);
+  if (!keyword)
+    return kind;
+  const KeywordKinds &slot = keywordKinds[keyword - keywords->slots.data()];
+  return slot.host == kind ? slot.keyword : kind;
+}
+
+void TableDrivenLexer::addToken(size_t start, size_t length, uint32_t kind)
+{
+  std::string_view lexeme = source.substr(start, length);
+  if (keywords)
+    kind = keywordKind(kind, lexeme);
+
+  tokens.push_back(LexerToken{ kind,
+                               static_cast<uint32_t>(start),
+                               static_cast<uint32_t>(length) });
+
+  if (echo && kind != WHITESPACE_KIND) { // Skip whitespace tokens
+    std::cout << "Token: " << kindNames[kind] << ", Lexeme: \"" << lexeme
+              << "\"" << std::endl;
+  }
+}
+
+void TableDrivenLexer::addUnknown(size_t pos)
+{
+  // add invalid (unknown token) to tokens
+  tokens.push_back(LexerToken{ UNKNOWN_KIND, static_cast<uint32_t>(pos), 1 });
+
+  *errors << "Invalid input at position " << pos << ": '" << source[pos]
+            << "'" << std::endl;
+}
+
+void TableDrivenLexer::createSymbolTable(std::string_view input,
                                          const std::string &file,
                                          bool printWhitespace)
 {
   // ensure that token list is generated by calling lex()
   lex(input);
+  writeSymbolTable(file, printWhitespace);
+}
 
-  FILE *symbolTableFile;
-  symbolTableFile = fopen(file.c_str(), "w");
+void TableDrivenLexer::writeSymbolTable(const std::string &file,
+                                        bool printWhitespace)
+{
+  std::ofstream symbolTableFile(file);
 
-  if (symbolTableFile == NULL) {
+  if (!symbolTableFile) {
     perror("error opening symbol table file");
     return;
   }
 
-  fprintf(symbolTableFile, "%-30s %s\n", "LEXEME", "TOKEN");
+  writeSymbolTable(symbolTableFile, printWhitespace);
+}
+
+void TableDrivenLexer::writeSymbolTable(std::ostream &out,
+                                        bool printWhitespace)
+{
+  out << std::left << std::setw(30) << "LEXEME" << " TOKEN\n";
   for (const auto &token : tokens) {
-    if (token.type == "WHITESPACE" && !printWhitespace)
+    if (token.kind == WHITESPACE_KIND && !printWhitespace)
       continue;
 
-    fprintf(symbolTableFile,
-            "%-30s %s\n",
-            token.lexeme.c_str(),
-            token.type.c_str());
+    out << std::setw(30) << token.lexeme(source) << ' '
+        << kindNames[token.kind] << '\n';
   }
-
-  fclose(symbolTableFile);
 }
\ No newline at end of file
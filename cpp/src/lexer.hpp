@@ -1,29 +1,515 @@
+#ifndef LEXER_HPP
+#define LEXER_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <stdexcept>
+#include <string_view>
+#include <thread>
+#include <unordered_set>
+#include <vector>
 #include "./dfa.hpp"
+#include "./lazy_dfa.hpp"
+#include "./table_image.hpp"
+
+// token as a slice of the lexed input, no strings are copied. kind indexes
+// the token kind names of the lexer that produced it
+struct LexerToken {
+  uint32_t kind;
+  uint32_t offset;
+  uint32_t length;
+
+  std::string_view lexeme(std::string_view source) const
+  {
+    return source.substr(offset, length);
+  }
+};
 
-class LexerToken
+// (state, position) pairs an automaton was in without accepting before it
+// died, see TableDrivenLexer::setMemoize
+class FailedPairs
 {
+private:
+  std::unordered_set<uint64_t> pairs;
+  size_t pruneAt;
+
+  static uint64_t key(int state, size_t pos)
+  {
+    return static_cast<uint64_t>(pos) << 32 | static_cast<uint32_t>(state);
+  }
+
 public:
-  std::string lexeme;
-  std::string type;
+  FailedPairs() : pruneAt(4096) {}
 
-  LexerToken(std::string lexeme, std::string type) : lexeme(lexeme), type(type)
+  bool contains(int state, size_t pos) const
   {
+    return pairs.count(key(state, pos)) > 0;
   }
+  void insert(int state, size_t pos) { pairs.insert(key(state, pos)); }
+  void clear() { pairs.clear(); }
+
+  // drops the pairs before pos, which no later match reaches. only walks
+  // the set once it has doubled since the last prune
+  void prune(size_t pos);
 };
 
 class TableDrivenLexer
 {
 private:
-  TransitionTable transitionTable;
+  const TransitionTable *transitionTable;
+  // used instead of transitionTable when set
+  LazyDFA *lazyDFA;
+  const TableImage *tableImage;
+  const CombTable *combTable;
+  // keywords the table leaves to a catch-all pattern, nullptr if none
+  const KeywordTable *keywords;
+  bool memoize;
+  bool echo;
+  unsigned threads;
+  std::ostream *errors; // where invalid input is reported
   std::vector<LexerToken> tokens;
+  std::string_view source; // input of the last lex() or scan()
+
+  // names of the kinds seen so far, a kind is its index
+  std::vector<std::string> kindNames = { "UNKNOWN", "WHITESPACE" };
+  std::map<std::string, uint32_t, std::less<>> kindIds = {
+    { "UNKNOWN", UNKNOWN_KIND },
+    { "WHITESPACE", WHITESPACE_KIND },
+  };
+
+  // kind of each accepting state of the automaton being scanned, so that
+  // no token looks its type name up. NO_KIND for the other states and, for
+  // a LazyDFA, for states not accepted in yet
+  static constexpr uint32_t NO_KIND = UINT32_MAX;
+  std::vector<uint32_t> stateKinds;
+  // the attached automaton stateKinds is for, nullptr after scanning any
+  // other, which may have been a temporary
+  const void *kindsFor;
+  size_t kindsFlushes; // LazyDFA flushes stateKinds is up to date with
+
+  // kinds of the keyword in each slot of keywords and of its host type
+  struct KeywordKinds {
+    uint32_t host;
+    uint32_t keyword;
+  };
+  std::vector<KeywordKinds> keywordKinds;
+
+  uint32_t kindOf(std::string_view name);
+
+  // fills stateKinds for automaton
+  template <typename Automaton>
+  void resolveKinds(const Automaton &automaton);
+  // kind of the accepting state the automaton is in
+  template <typename Automaton>
+  uint32_t acceptKind(const Automaton &automaton, int state);
+  // kind of a token of the given kind, its keyword's if it is a keyword
+  uint32_t keywordKind(uint32_t kind, std::string_view lexeme) const;
+
+  // appends source[start, start + length) as a token of the given kind, or
+  // of its keyword kind, and echoes it
+  void addToken(size_t start, size_t length, uint32_t kind);
+  // appends source[pos] as an UNKNOWN token and reports it
+  void addUnknown(size_t pos);
+
+  // longest match found by a scanParallel() worker, an UNKNOWN byte if
+  // length is 0. keyword kinds are only assigned when the matches are merged
+  struct Match {
+    uint32_t offset;
+    uint32_t length;
+    uint32_t kind;
+  };
+
+  // length of the longest match at start, 0 if there is none, and its kind
+  template <typename Automaton>
+  size_t longestMatch(Automaton &automaton,
+                      std::string_view input,
+                      size_t start,
+                      uint32_t &kind);
+
+  template <typename Automaton>
+  void scanMemoized(Automaton &&automaton, std::string_view input);
+
+  template <typename Automaton>
+  void scanParallel(Automaton &automaton,
+                    std::string_view input,
+                    unsigned workers);
 
 public:
-  TableDrivenLexer(const TransitionTable &table) : transitionTable(table) {}
+  // kinds every lexer has, whatever its patterns
+  static constexpr uint32_t UNKNOWN_KIND = 0;
+  static constexpr uint32_t WHITESPACE_KIND = 1;
 
-  void lex(const std::string &input);
+  // for use with scan() only, lex() needs a table
+  TableDrivenLexer()
+      : transitionTable(nullptr), lazyDFA(nullptr), tableImage(nullptr),
+        combTable(nullptr), keywords(nullptr), memoize(false), echo(true),
+        threads(1), errors(&std::cerr), kindsFor(nullptr), kindsFlushes(0)
+  {
+  }
+
+  // table must outlive the lexer, lexers on several threads can share it
+  TableDrivenLexer(const TransitionTable &table)
+      : transitionTable(&table), lazyDFA(nullptr), tableImage(nullptr),
+        combTable(nullptr), keywords(nullptr), memoize(false), echo(true),
+        threads(1), errors(&std::cerr), kindsFor(nullptr), kindsFlushes(0)
+  {
+    resolveKinds(table);
+  }
+
+  // lex with states determinized on demand, lazy must outlive the lexer.
+  // it is not safe to share between threads
+  TableDrivenLexer(LazyDFA &lazy)
+      : transitionTable(nullptr), lazyDFA(&lazy), tableImage(nullptr),
+        combTable(nullptr), keywords(nullptr), memoize(false), echo(true),
+        threads(1), errors(&std::cerr), kindsFor(nullptr), kindsFlushes(0)
+  {
+    resolveKinds(lazy);
+  }
+
+  // lex straight from a mapped table, image must outlive the lexer
+  TableDrivenLexer(const TableImage &image)
+      : transitionTable(nullptr), lazyDFA(nullptr), tableImage(&image),
+        combTable(nullptr), keywords(nullptr), memoize(false), echo(true),
+        threads(1), errors(&std::cerr), kindsFor(nullptr), kindsFlushes(0)
+  {
+    resolveKinds(image);
+  }
+
+  // lex from the comb compressed table, comb must outlive the lexer
+  TableDrivenLexer(const CombTable &comb)
+      : transitionTable(nullptr), lazyDFA(nullptr), tableImage(nullptr),
+        combTable(&comb), keywords(nullptr), memoize(false), echo(true),
+        threads(1), errors(&std::cerr), kindsFor(nullptr), kindsFlushes(0)
+  {
+    resolveKinds(comb);
+  }
+
+  // classify the tokens of a table generated with KeywordMode::HASH,
+  // table must outlive the lexer
+  void setKeywords(const KeywordTable &table);
+
+  // when on, scan() remembers the (state, position) pairs a match died
+  // from without accepting and stops any later match that reaches one of
+  // them, Reps' memoized maximal munch. lexing then stays linear in the
+  // input where plain longest match rescans the same bytes after every
+  // failed run ahead, at the cost of bookkeeping on every byte
+  void setMemoize(bool on) { memoize = on; }
+
+  // every token is printed as it is found unless this is turned off
+  void setEcho(bool on) { echo = on; }
+
+  // invalid input is reported to std::cerr unless another stream is set,
+  // which must outlive the lexer
+  void setErrors(std::ostream &stream) { errors = &stream; }
+
+  // lexes inputs of at least MIN_CHUNK bytes a thread on up to count
+  // threads. each lexes its chunk from the start state and the seams are
+  // relexed until they agree with the next chunk, so the tokens are the
+  // same as with one thread. a LazyDFA or memoized scan stays on one
+  static constexpr size_t MIN_CHUNK = 64 * 1024;
+  void setThreads(unsigned count) { threads = std::max(count, 1u); }
+
+  void lex(std::string_view input);
+
+  // longest-match loop over any automaton with start(), next(state, c)
+  // returning -1 for no transition, isAccept(state), tokenType(state) and,
+  // unless it has flushes() like a LazyDFA, stateCount(): TransitionTable,
+  // CombTable, LazyDFA, TableImage or a StaticDFA. the ones that also have
+  // skip(state, text, size) get their accelerated states scanned with it
+  template <typename Automaton>
+  void scan(Automaton &&automaton, std::string_view input);
+
+  // tokens of the last lex() or scan(), their lexemes point into its input,
+  // which must still be alive to read them
+  const std::vector<LexerToken> &getTokens() const { return tokens; }
+  std::string_view lexeme(const LexerToken &token) const
+  {
+    return token.lexeme(source);
+  }
+  std::string_view kindName(uint32_t kind) const { return kindNames[kind]; }
 
   // calls lex()
-  void createSymbolTable(const std::string &input,
+  void createSymbolTable(std::string_view input,
                          const std::string &file,
                          bool printWhitespace = false);
-};
\ No newline at end of file
+
+  // writes the tokens of the last lex() or scan()
+  void writeSymbolTable(const std::string &file, bool printWhitespace = false);
+  void writeSymbolTable(std::ostream &out, bool printWhitespace = false);
+};
+
+template <typename Automaton>
+void TableDrivenLexer::scan(Automaton &&automaton, std::string_view input)
+{
+  if (input.size() > UINT32_MAX)
+    throw std::length_error("input too large for 32-bit token offsets");
+  // a lexer can be reused, each scan starts a new token list
+  tokens.clear();
+  source = input;
+  if (&automaton != kindsFor)
+    resolveKinds(automaton);
+
+  if (memoize) {
+    scanMemoized(automaton, input);
+    return;
+  }
+
+  // a lazy dfa determinizes into a cache its workers would have to share
+  constexpr bool lazy = requires { automaton.flushes(); };
+  unsigned workers = std::min<size_t>(threads, input.size() / MIN_CHUNK);
+  if constexpr (!lazy) {
+    if (workers > 1) {
+      scanParallel(automaton, input, workers);
+      return;
+    }
+  }
+
+  size_t tokenStart = 0;
+  while (tokenStart < input.size()) {
+    uint32_t kind;
+    size_t length = longestMatch(automaton, input, tokenStart, kind);
+    if (length > 0) {
+      addToken(tokenStart, length, kind);
+      tokenStart += length;
+    } else {
+      // No valid token found - skip one character
+      addUnknown(tokenStart);
+      tokenStart++;
+    }
+  }
+}
+
+template <typename Automaton>
+void TableDrivenLexer::resolveKinds(const Automaton &automaton)
+{
+  const void *attached[] = { transitionTable, lazyDFA, tableImage, combTable };
+  kindsFor = std::find(std::begin(attached), std::end(attached), &automaton) !=
+          std::end(attached)
+      ? &automaton
+      : nullptr;
+
+  // a lazy dfa's states are resolved as they are accepted in
+  if constexpr (requires { automaton.flushes(); }) {
+    stateKinds.clear();
+    kindsFlushes = automaton.flushes();
+  } else {
+    stateKinds.assign(automaton.stateCount(), NO_KIND);
+    for (int state = 0; state < static_cast<int>(stateKinds.size()); state++)
+      if (automaton.isAccept(state))
+        stateKinds[state] = kindOf(automaton.tokenType(state));
+  }
+}
+
+template <typename Automaton>
+uint32_t TableDrivenLexer::acceptKind(const Automaton &automaton, int state)
+{
+  if constexpr (requires { automaton.flushes(); }) {
+    // a flush reuses the state ids for other states
+    if (automaton.flushes() != kindsFlushes) {
+      stateKinds.clear();
+      kindsFlushes = automaton.flushes();
+    }
+    if (static_cast<size_t>(state) >= stateKinds.size())
+      stateKinds.resize(state + 1, NO_KIND);
+    if (stateKinds[state] == NO_KIND)
+      stateKinds[state] = kindOf(automaton.tokenType(state));
+  }
+  return stateKinds[state];
+}
+
+template <typename Automaton>
+size_t TableDrivenLexer::longestMatch(Automaton &automaton,
+                                      std::string_view input,
+                                      size_t start,
+                                      uint32_t &kind)
+{
+  int currentState = automaton.start();
+  size_t length = 0;
+
+  // the token kind is kept rather than the accepting state, since a lazy
+  // dfa may flush its cache and reuse state ids mid-token
+  size_t pos = start;
+  size_t run = 0;
+  while (pos < input.size()) {
+    int nextState = automaton.next(currentState, input[pos]);
+    if (nextState == -1) {
+      break;
+    }
+    pos++;
+
+    // jump over the rest of a run that has looped back to an accelerated
+    // state Accelerator::MIN_RUN times
+    if (nextState != currentState) {
+      currentState = nextState;
+      run = 0;
+    } else if (++run == Accelerator::MIN_RUN) {
+      if constexpr (requires { automaton.skip(0, input.data(), size_t{}); })
+        pos += automaton.skip(currentState, input.data() + pos,
+                              input.size() - pos);
+    }
+
+    if (automaton.isAccept(currentState)) {
+      kind = acceptKind(automaton, currentState);
+      length = pos - start;
+    }
+  }
+  return length;
+}
+
+template <typename Automaton>
+void TableDrivenLexer::scanParallel(Automaton &automaton,
+                                    std::string_view input,
+                                    unsigned workers)
+{
+  // chunk k is [bounds[k], bounds[k + 1]), split after a newline where
+  // there is one, since most tokens end at a line end
+  std::vector<size_t> bounds(workers + 1, input.size());
+  bounds[0] = 0;
+  for (unsigned k = 1; k < workers; k++) {
+    size_t newline = input.find('\n', input.size() / workers * k);
+    if (newline != std::string_view::npos)
+      bounds[k] = std::max(bounds[k - 1], newline + 1);
+  }
+
+  // each worker lexes from the start of its chunk as if a token began
+  // there, until a token would start in the next chunk
+  std::vector<std::vector<Match>> chunks(workers);
+  auto lexChunk = [&](unsigned k) {
+    for (size_t pos = bounds[k]; pos < bounds[k + 1];) {
+      uint32_t kind = UNKNOWN_KIND;
+      size_t length = longestMatch(automaton, input, pos, kind);
+      chunks[k].push_back({ static_cast<uint32_t>(pos),
+                            static_cast<uint32_t>(length), kind });
+      pos += length > 0 ? length : 1;
+    }
+  };
+  std::vector<std::thread> pool;
+  for (unsigned k = 1; k < workers; k++)
+    pool.emplace_back(lexChunk, k);
+  lexChunk(0);
+  for (std::thread &thread : pool)
+    thread.join();
+
+  auto add = [&](const Match &match) {
+    if (match.length > 0)
+      addToken(match.offset, match.length, match.kind);
+    else
+      addUnknown(match.offset);
+  };
+
+  // a match depends only on where it starts, so once the real token stream
+  // starts a token where a chunk did, the rest of that chunk is right. up to
+  // there, as when a seam falls inside a string or comment, it is relexed
+  size_t pos = 0;
+  for (unsigned k = 0; k < workers; k++) {
+    const std::vector<Match> &chunk = chunks[k];
+    auto next = chunk.begin();
+    while (pos < bounds[k + 1]) {
+      while (next != chunk.end() && next->offset < pos)
+        ++next;
+      if (next != chunk.end() && next->offset == pos)
+        break;
+
+      uint32_t kind = UNKNOWN_KIND;
+      size_t length = longestMatch(automaton, input, pos, kind);
+      add({ static_cast<uint32_t>(pos), static_cast<uint32_t>(length), kind });
+      pos += length > 0 ? length : 1;
+    }
+    if (pos >= bounds[k + 1])
+      continue;
+
+    for (; next != chunk.end(); ++next)
+      add(*next);
+    pos = chunk.back().offset + std::max<uint32_t>(chunk.back().length, 1);
+  }
+}
+
+template <typename Automaton>
+void TableDrivenLexer::scanMemoized(Automaton &&automaton,
+                                    std::string_view input)
+{
+  // pairs since the last accept, a state looping over count bytes is one run
+  struct Run {
+    int state;
+    size_t pos;
+    size_t count;
+  };
+
+  FailedPairs failed;
+  std::vector<Run> trail;
+  // no pair after the furthest position a match has reached can have failed,
+  // so matches only look pairs up before it and skip freely after it
+  size_t furthest = 0;
+  size_t flushes = 0;
+
+  size_t tokenStart = 0;
+  while (tokenStart < input.size()) {
+    int state = automaton.start();
+    uint32_t lastAcceptKind = UNKNOWN_KIND;
+    size_t lastAcceptEnd = 0;
+    trail.clear();
+
+    size_t pos = tokenStart;
+    size_t run = 0;
+    while (pos < input.size()) {
+      if (pos <= furthest && failed.contains(state, pos))
+        break;
+      if (!trail.empty() && trail.back().state == state &&
+          trail.back().pos + trail.back().count == pos)
+        trail.back().count++;
+      else
+        trail.push_back({ state, pos, 1 });
+
+      int nextState = automaton.next(state, input[pos]);
+      // a lazy dfa that flushed its cache reuses the state ids of the pairs
+      if constexpr (requires { automaton.flushes(); }) {
+        if (automaton.flushes() != flushes) {
+          flushes = automaton.flushes();
+          failed.clear();
+          trail.clear();
+        }
+      }
+      if (nextState == -1)
+        break;
+      pos++;
+
+      if (nextState != state) {
+        state = nextState;
+        run = 0;
+      } else if (++run == Accelerator::MIN_RUN && pos > furthest) {
+        if constexpr (requires { automaton.skip(0, input.data(), size_t{}); }) {
+          size_t skipped =
+              automaton.skip(state, input.data() + pos, input.size() - pos);
+          if (skipped > 0)
+            trail.push_back({ state, pos, skipped });
+          pos += skipped;
+        }
+      }
+
+      if (automaton.isAccept(state)) {
+        lastAcceptKind = acceptKind(automaton, state);
+        lastAcceptEnd = pos;
+        trail.clear();
+      }
+    }
+
+    // nothing is accepted from any pair since the last accept
+    furthest = std::max(furthest, pos);
+    for (const Run &r : trail)
+      for (size_t i = 0; i < r.count; i++)
+        failed.insert(r.state, r.pos + i);
+
+    if (lastAcceptEnd > tokenStart) {
+      addToken(tokenStart, lastAcceptEnd - tokenStart, lastAcceptKind);
+      tokenStart = lastAcceptEnd;
+    } else {
+      addUnknown(tokenStart);
+      tokenStart++;
+    }
+    failed.prune(tokenStart);
+  }
+}
+
+#endif
\ No newline at end of file
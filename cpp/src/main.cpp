@@ -1,12 +1,17 @@
+#include "./batch.hpp"
 #include "./dfa.hpp"
 #include "./nfa.hpp"
 #include "./regex_parser.hpp"
 #include "./lexer.hpp"
+#include "./source_buffer.hpp"
+#include "./table_image.hpp"
+#include "./tinyai_patterns.hpp"
 #include <iostream>
 #include <string>
 #include <vector>
 #include <fstream>
-#include <sstream>
+#include <memory>
+#include <thread>
 #include <string>
 
 bool fileExists(const std::string &filename)
@@ -26,151 +31,279 @@ bool correctExtension(const std::string &filename, const std::string &extension)
   return fileExt == extension;
 }
 
-std::string readFileToString(const std::string &filename)
-{
-  std::ifstream file(filename);
-  std::ostringstream buffer;
-  buffer << file.rdbuf();
-  return buffer.str();
-}
-
 int main(int argc, char *argv[])
 {
-  if (argc < 2)
+  Construction construction = Construction::THOMPSON_SUBSET;
+  bool lazy = false;
+  bool rebuild = false;
+  bool useStatic = false;
+  bool memoize = false;
+  bool quiet = false;
+  bool batch = false;
+  unsigned threads = 1;
+  // a batch runs on every core unless --threads says otherwise
+  unsigned batchWorkers = std::thread::hardware_concurrency();
+  TableEncoding encoding = TableEncoding::DENSE;
+  KeywordMode keywordMode = KeywordMode::DFA;
+  size_t lazyBudget = 4096;
+  std::string inputFile;
+
+  for (int i = 1; i < argc; i++)
   {
-    std::cerr << "Usage: " << argv[0] << " <input_file>" << std::endl;
+    std::string arg = argv[i];
+    if (arg == "--followpos")
+      construction = Construction::FOLLOWPOS;
+    else if (arg == "--lazy")
+      lazy = true;
+    else if (arg == "--rebuild")
+      rebuild = true;
+    else if (arg == "--static")
+      useStatic = true;
+    else if (arg == "--memoize")
+      memoize = true;
+    else if (arg == "--quiet")
+      quiet = true;
+    else if (arg == "--batch")
+      batch = true;
+    else if (arg == "--threads" && i + 1 < argc)
+    {
+      threads = std::stoul(argv[++i]);
+      if (threads == 0)
+        threads = std::thread::hardware_concurrency();
+      batchWorkers = threads;
+    }
+    else if (arg == "--encoding" && i + 1 < argc)
+    {
+      std::string name = argv[++i];
+      if (name == "dense")
+        encoding = TableEncoding::DENSE;
+      else if (name == "comb")
+        encoding = TableEncoding::COMB;
+      else if (name == "direct")
+        encoding = TableEncoding::DIRECT;
+      else if (name == "packed")
+        encoding = TableEncoding::PACKED;
+      else
+      {
+        std::cerr << "Error: unknown encoding '" << name
+                  << "', expected dense, comb, direct or packed" << std::endl;
+        return 1;
+      }
+    }
+    else if (arg == "--keywords" && i + 1 < argc)
+    {
+      std::string name = argv[++i];
+      if (name == "dfa")
+        keywordMode = KeywordMode::DFA;
+      else if (name == "hash")
+        keywordMode = KeywordMode::HASH;
+      else
+      {
+        std::cerr << "Error: unknown keyword mode '" << name
+                  << "', expected dfa or hash" << std::endl;
+        return 1;
+      }
+    }
+    else if (arg == "--lazy-budget" && i + 1 < argc)
+    {
+      lazy = true;
+      lazyBudget = std::stoul(argv[++i]);
+    }
+    else
+      inputFile = arg;
+  }
+
+  if (inputFile.empty())
+  {
+    std::cerr << "Usage: " << argv[0]
+              << " [--followpos] [--rebuild] [--static] [--memoize] [--lazy]"
+              << " [--threads <n>] [--quiet] [--batch]"
+              << " [--lazy-budget <states>]"
+              << " [--encoding dense|comb|direct|packed]"
+              << " [--keywords dfa|hash]"
+              << " <input_file | directory | list | ->"
+              << std::endl;
     return 1;
   }
-  std::string inputFile = argv[1];
 
-  if (!fileExists(inputFile))
+  // a batch lexes every .ai file under a directory, or every file listed
+  // in a file or on stdin
+  std::vector<std::string> sources;
+  if (batch && !collectSources(inputFile, sources))
+  {
+    std::cerr << "Error: could not list the sources in '" << inputFile
+              << "'." << std::endl;
+    return 1;
+  }
+
+  // "-" lexes stdin
+  if (!batch && inputFile != "-" && !fileExists(inputFile))
   {
     std::cerr << "Error: File '" << inputFile << "' does not exist."
               << std::endl;
     return 1;
   }
 
-  if (!correctExtension(inputFile, ".ai"))
+  if (!batch && inputFile != "-" && !correctExtension(inputFile, ".ai"))
   {
     std::cerr << "Error: File '" << inputFile
               << "' does not have the correct '.ai' extension." << std::endl;
     return 1;
   }
 
-  std::vector<RegexPattern> patterns = {
-      // Keywords (0-19)
-      RegexPattern("if", "IF_TOK", 0),
-      RegexPattern("else", "ELSE_TOK", 1),
-      RegexPattern("elif", "ELIF_TOK", 2),
-      RegexPattern("for", "FOR_TOK", 3),
-      RegexPattern("while", "WHILE_TOK", 4),
-      RegexPattern("break", "BREAK_TOK", 5),
-      RegexPattern("continue", "CONTINUE_TOK", 6),
-      RegexPattern("return", "RETURN_TOK", 7),
-      RegexPattern("func", "FUNC_TOK", 8),
-      RegexPattern("import", "IMPORT_TOK", 9),
-      RegexPattern("from", "FROM_TOK", 10),
-      RegexPattern("as", "AS_TOK", 11),
-      RegexPattern("print", "PRINT_TOK", 12),
-      RegexPattern("in", "IN_TOK", 13),
-      RegexPattern("use", "USE_TOK", 14),
-      RegexPattern("with", "WITH_TOK", 15),
-      RegexPattern("numpy", "NUMPY_TOK", 16),
-      RegexPattern("then", "THEN", 17),
-      RegexPattern("end", "END", 18),
-      RegexPattern("do", "DO", 19),
-
-      // Data types (20-29)
-      RegexPattern("int", "INT_TOK", 20),
-      RegexPattern("float", "FLOAT_TOK", 21),
-      RegexPattern("bool", "BOOL_TOK", 22),
-      RegexPattern("char", "CHAR_TOK", 23),
-      RegexPattern("string", "STRING_TOK", 24),
-      RegexPattern("tensor", "TENSOR_TOK", 25),
-      RegexPattern("matrix", "MATRIX_TOK", 26),
-      RegexPattern("array", "ARRAY_TOK", 27),
-      RegexPattern("void", "VOID_TOK", 28),
-
-      // lost keyword (29)
-      RegexPattern("input", "INPUT_TOK", 29),
-
-      // Math functions (30-49)
-      RegexPattern("rand", "RAND_TOK", 30),
-      RegexPattern("zeros", "ZEROS_TOK", 31),
-      RegexPattern("ones", "ONES_TOK", 32),
-      RegexPattern("mean", "MEAN_TOK", 33),
-      RegexPattern("sum", "SUM_TOK", 34),
-      RegexPattern("dot", "DOT_TOK", 35),
-      RegexPattern("max", "MAX_TOK", 36),
-      RegexPattern("min", "MIN_TOK", 37),
-      RegexPattern("std", "STD_TOK", 38),
-      RegexPattern("var", "VAR_TOK", 39),
-
-      // Data handling functions (50-69)
-      RegexPattern("to_array", "TOARRAY_TOK", 50),
-      RegexPattern("read_csv", "READCSV_TOK", 51),
-      RegexPattern("to_tensor", "TOTENSOR_TOK", 52),
-      RegexPattern("normalize", "NORMALIZE_TOK", 53),
-      RegexPattern("flatten", "FLATTEN_TOK", 54),
-      RegexPattern("concat", "CONCAT_TOK", 55),
-      RegexPattern("slice", "SLICE_TOK", 56),
-      RegexPattern("sort", "SORT_TOK", 57),
-      RegexPattern("filter", "FILTER_TOK", 58),
-
-      // Multi-character operators (70-89)
-      RegexPattern("\\*\\*", "DOUBLE_ASTERISK", 70),
-      RegexPattern("==", "EQUAL", 71),
-      RegexPattern("<=", "LESS_EQUAL", 72),
-      RegexPattern(">=", "GREATER_EQUAL", 73),
-      RegexPattern("!=", "NOT_EQUAL", 74),
-      RegexPattern("and", "AND", 75),
-      RegexPattern("or", "OR", 76),
-      RegexPattern("not", "NOT", 77),
-      RegexPattern("//", "DOUBLE_SLASH", 78),
-
-      // Single-character operators (90-109)
-      RegexPattern("\\+", "PLUS", 90),
-      RegexPattern("\\*", "ASTERISK", 91),
-      RegexPattern("-", "MINUS", 92),
-      RegexPattern("/", "SLASH", 93),
-      RegexPattern("=", "ASSIGN", 94),
-      RegexPattern("%", "MODULO", 95),
-      RegexPattern("<", "LESS_THAN", 96),
-      RegexPattern(">", "GREATER_THAN", 97),
-
-      // Delimiters (110-129)
-      RegexPattern("\\(", "LEFT_PARENTHESIS", 110),
-      RegexPattern("\\)", "RIGHT_PARENTHESIS", 111),
-      RegexPattern("\\[", "LEFT_SQUARE_BRACKET", 112),
-      RegexPattern("\\]", "RIGHT_SQUARE_BRACKET", 113),
-      RegexPattern("\\{", "LEFT_CURLY_BRACE", 114),
-      RegexPattern("\\}", "RIGHT_CURLY_BRACE", 115),
-      RegexPattern(",", "COMMA", 116),
-      RegexPattern(":", "COLON", 117),
-      RegexPattern(";", "SEMI_COLON", 118),
-
-      // Literals (130-149)
-      RegexPattern("\\\"\\\"\\\"[\\s\\S]*\\\"\\\"\\\"", "MULTILINE_COMMENT", 130),
-      RegexPattern("\\\"[^\\\"\\n]*\\\"", "STRING_LITERAL", 131),
-      RegexPattern("\\'[^\\'\\n]\\'", "CHAR_LITERAL", 132),
-      RegexPattern("\\d+\\.\\d+", "FLOAT_LITERAL", 133),
-      RegexPattern("\\d+", "INT_LITERAL", 134),
-      RegexPattern("true|false", "BOOL_LITERAL", 135),
-
-      // Comments and whitespace (150-159)
-      RegexPattern("#[^\n]*", "COMMENT", 150),
-      RegexPattern("\\s+", "WHITESPACE", 151),
-
-      // Identifier must be last
-      RegexPattern("[a-zA-Z][a-zA-Z0-9_]*", "IDENTIFIER", INT_MAX)};
-
-  TransitionTableGenerator tableGenerator(patterns);
+  SourceBuffer source;
+  if (!batch && !source.load(inputFile))
+  {
+    std::cerr << "Error: could not read '" << inputFile << "'." << std::endl;
+    return 1;
+  }
+  std::string_view input = source.view();
+
+  auto lexTable = [](TableDrivenLexer &lexer, std::string_view text)
+  { lexer.lex(text); };
+
+  // lexes the input, or every source of a batch on batchWorkers threads,
+  // with the lexers makeLexer returns and writes symbol_table.txt. the
+  // automaton is built or loaded once and shared by the whole batch
+  auto run = [&](const MakeBatchLexer &makeLexer, const BatchLex &lex)
+  {
+    if (!batch)
+    {
+      TableDrivenLexer lexer = makeLexer(0);
+      lexer.setMemoize(memoize);
+      lexer.setThreads(threads);
+      lexer.setEcho(!quiet);
+      lex(lexer, input);
+      lexer.writeSymbolTable("symbol_table.txt");
+      return;
+    }
+
+    std::ofstream symbols("symbol_table.txt");
+    if (!symbols)
+    {
+      perror("error opening symbol table file");
+      return;
+    }
+
+    // files are lexed on one thread each and never echoed
+    auto makeWorker = [&](unsigned id)
+    {
+      TableDrivenLexer lexer = makeLexer(id);
+      lexer.setMemoize(memoize);
+      lexer.setEcho(false);
+      return lexer;
+    };
+    size_t failed =
+        lexBatch(sources, batchWorkers, makeWorker, lex, symbols, std::cerr);
+    if (failed > 0)
+      std::cerr << failed << " of " << sources.size()
+                << " source files failed" << std::endl;
+  };
+
+  if (useStatic)
+  {
+    // table compiled into the binary, nothing is built or loaded
+    run([](unsigned) { return TableDrivenLexer(); },
+        [](TableDrivenLexer &lexer, std::string_view text)
+        { lexer.scan(StaticDFA<tinyaiPatterns>(), text); });
+    return 0;
+  }
+
+  std::vector<RegexPattern> patterns;
+  for (const StaticPattern &pattern : tinyaiPatterns)
+    patterns.emplace_back(pattern.pattern, pattern.tokenType, pattern.priority);
+
+  TransitionTableGenerator tableGenerator(patterns, construction);
+  tableGenerator.setEncoding(encoding);
+  tableGenerator.setKeywordMode(keywordMode);
+
+  if (lazy)
+  {
+    // determinize only the states the input reaches, no table is emitted
+    NFA nfa = tableGenerator.buildNFA();
+
+    // the cache of a lazy dfa can't be shared, so every batch worker
+    // determinizes its own from the shared nfa
+    std::vector<std::unique_ptr<LazyDFA>> lazyDFAs(
+        std::max(batch ? batchWorkers : 1u, 1u));
+    run(
+        [&](unsigned id)
+        {
+          lazyDFAs[id] = std::make_unique<LazyDFA>(nfa, lazyBudget);
+          return TableDrivenLexer(*lazyDFAs[id]);
+        },
+        lexTable);
+
+    size_t statesBuilt = 0, flushes = 0;
+    for (const std::unique_ptr<LazyDFA> &lazyDFA : lazyDFAs)
+    {
+      if (!lazyDFA)
+        continue;
+      statesBuilt += lazyDFA->statesBuilt();
+      flushes += lazyDFA->flushes();
+    }
+    std::cout << "Lazy DFA: " << statesBuilt << " states built, " << flushes
+              << " cache flushes" << std::endl;
+    return 0;
+  }
+
+  // reuse the table from the last run when the patterns haven't changed
+  uint64_t patternHash =
+      hashPatterns(patterns, static_cast<uint32_t>(encoding) |
+                                 static_cast<uint32_t>(keywordMode) << 8);
+  TableImage image;
+  if (!rebuild && fileExists("transition_table.c") &&
+      fileExists("transition_table.h") && image.load("transition_table.bin") &&
+      image.patternHash() == patternHash)
+  {
+    std::cout << "Patterns unchanged, using transition_table.bin" << std::endl;
+
+    // the image only holds the DFA, its keywords are found again from it
+    KeywordTable keywords;
+    if (keywordMode == KeywordMode::HASH)
+      keywords = KeywordTable::find(patterns, image);
+
+    run(
+        [&](unsigned)
+        {
+          TableDrivenLexer lexer(image);
+          lexer.setKeywords(keywords);
+          return lexer;
+        },
+        lexTable);
+    return 0;
+  }
+
   TransitionTable table = tableGenerator.generate();
   tableGenerator.generateToFile("transition_table");
+  if (!TableImage::write(table, patternHash, "transition_table.bin"))
+    std::cerr << "Warning: could not write transition_table.bin" << std::endl;
+
+  if (encoding == TableEncoding::COMB)
+  {
+    CombTable comb(table);
+    std::cout << "Comb table: " << comb.nxt.size() << " slots for "
+              << table.transitions.size() << " entries" << std::endl;
+
+    run(
+        [&](unsigned)
+        {
+          TableDrivenLexer lexer(comb);
+          lexer.setKeywords(tableGenerator.keywordTable());
+          return lexer;
+        },
+        lexTable);
+    return 0;
+  }
 
-  TableDrivenLexer lexer(table);
-  std::string input = readFileToString(inputFile);
-  lexer.createSymbolTable(input, "symbol_table.txt");
+  run(
+      [&](unsigned)
+      {
+        TableDrivenLexer lexer(table);
+        lexer.setKeywords(tableGenerator.keywordTable());
+        return lexer;
+      },
+      lexTable);
 
   return 0;
 }
\ No newline at end of file
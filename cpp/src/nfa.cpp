@@ -11,6 +11,32 @@ bool NFATransition::matches(char c) const
   return symbol == c || symbol == EPSILON;
 }
 
+bool StateSet::empty() const
+{
+  for (uint64_t word : words) {
+    if (word)
+      return false;
+  }
+  return true;
+}
+
+size_t StateSet::hash() const
+{
+  // FNV-1a over the words
+  uint64_t h = 14695981039346656037ull;
+  for (uint64_t word : words) {
+    h ^= word;
+    h *= 1099511628211ull;
+  }
+  return static_cast<size_t>(h ^ (h >> 32));
+}
+
+void StateSet::unionWith(const StateSet &other)
+{
+  for (size_t w = 0; w < words.size(); w++)
+    words[w] |= other.words[w];
+}
+
 NFAState *NFA::createState()
 {
   auto state = std::make_unique<NFAState>(nextStateId++);
@@ -18,70 +44,104 @@ NFAState *NFA::createState()
   state->tokenPriority = INT_MAX;
   NFAState *ptr = state.get();
   states.push_back(std::move(state));
+  epsilonEdges.emplace_back();
+  symbolEdges.emplace_back();
+  closures.clear();
   return ptr;
 }
 
-void NFA::addTransition(NFAState *from, NFAState *to, char symb)
+void NFA::indexTransition(int index)
 {
-  // Add similar debug output for character class transitions
-  std::cout << "Adding char transition from state " << from->id << " to state "
-            << to->id << std::endl;
-
-  // Verify both states exist
-  bool fromExists = false;
-  bool toExists = false;
-  for (const auto &state : states) {
-    if (state.get() == from)
-      fromExists = true;
-    if (state.get() == to)
-      toExists = true;
-  }
+  const NFATransition &trans = transitions[index];
+  if (!trans.isCharClass && trans.symbol == EPSILON)
+    epsilonEdges[trans.from->id].push_back(index);
+  else
+    symbolEdges[trans.from->id].push_back(index);
+  closures.clear();
+}
+
+bool NFA::ownsState(const NFAState *state) const
+{
+  // states are stored at the index of their id, so a pointer issued by this
+  // nfa is found in O(1). states of another nfa fail the pointer comparison
+  return state && state->id >= 0 &&
+      static_cast<size_t>(state->id) < states.size() &&
+      states[state->id].get() == state;
+}
+
+void NFA::checkTransition(const NFAState *from, const NFAState *to) const
+{
+  bool fromExists = ownsState(from);
+  bool toExists = ownsState(to);
 
   if (!fromExists || !toExists) {
-    std::cout << "Error: Attempting to add transition with non-existent state!"
+    std::cerr << "Error: Attempting to add transition with non-existent state!"
               << std::endl;
-    std::cout << "FromState exists: " << fromExists << std::endl;
-    std::cout << "ToState exists: " << toExists << std::endl;
+    std::cerr << "FromState exists: " << fromExists << std::endl;
+    std::cerr << "ToState exists: " << toExists << std::endl;
     throw std::runtime_error("Invalid state in addTransition");
   }
+}
+
+void NFA::addTransition(NFAState *from, NFAState *to, char symb)
+{
+  checkTransition(from, to);
+
+  if (trace) {
+    std::cout << "Adding char transition from state " << from->id
+              << " to state " << to->id << std::endl;
+  }
+
   transitions.emplace_back(from, to, symb);
+  indexTransition(transitions.size() - 1);
 }
 
 void NFA::addTransition(NFAState *from, NFAState *to, const std::set<char> &cc)
 {
-  // Add similar debug output for character class transitions
-  std::cout << "Adding char class transition from state " << from->id
-            << " to state " << to->id << std::endl;
-
-  // Verify both states exist
-  bool fromExists = false;
-  bool toExists = false;
-  for (const auto &state : states) {
-    if (state.get() == from)
-      fromExists = true;
-    if (state.get() == to)
-      toExists = true;
-  }
+  checkTransition(from, to);
 
-  if (!fromExists || !toExists) {
-    std::cout << "Error: Attempting to add transition with non-existent state!"
-              << std::endl;
-    std::cout << "FromState exists: " << fromExists << std::endl;
-    std::cout << "ToState exists: " << toExists << std::endl;
-    throw std::runtime_error("Invalid state in addTransition");
+  if (trace) {
+    std::cout << "Adding char class transition from state " << from->id
+              << " to state " << to->id << std::endl;
   }
+
   transitions.emplace_back(from, to, cc);
+  indexTransition(transitions.size() - 1);
 }
 
 std::vector<NFATransition *> NFA::getTransitions(NFAState *state)
 {
   std::vector<NFATransition *> result;
-  for (auto &trans : transitions) {
-    if (trans.from == state) {
-      result.push_back(&trans);
+  for (int index : epsilonEdges[state->id])
+    result.push_back(&transitions[index]);
+  for (int index : symbolEdges[state->id])
+    result.push_back(&transitions[index]);
+  return result;
+}
+
+void NFA::computeClosures()
+{
+  closures.assign(states.size(), StateSet(states.size()));
+  std::vector<int> stack;
+
+  for (size_t id = 0; id < states.size(); id++) {
+    StateSet &closure = closures[id];
+    closure.insert(id);
+    stack.push_back(id);
+
+    while (!stack.empty()) {
+      int current = stack.back();
+      stack.pop_back();
+
+      for (int index : epsilonEdges[current]) {
+        int to = transitions[index].to->id;
+        if (!closure.contains(to)) {
+          closure.insert(to);
+          stack.push_back(to);
+        }
+      }
     }
   }
-  return result;
 }
 
 std::set<NFAState *> NFA::epsilonClosure(const std::set<NFAState *> &states)
@@ -93,14 +153,10 @@ std::set<NFAState *> NFA::epsilonClosure(const std::set<NFAState *> &states)
     NFAState *state = stack.back();
     stack.pop_back();
 
-    for (auto &trans : transitions) {
-      if (trans.from == state && trans.symbol == EPSILON &&
-          !trans.isCharClass) {
-        if (closure.find(trans.to) == closure.end()) {
-          closure.insert(trans.to);
-          stack.push_back(trans.to);
-        }
-      }
+    for (int index : epsilonEdges[state->id]) {
+      NFAState *to = transitions[index].to;
+      if (closure.insert(to).second)
+        stack.push_back(to);
     }
   }
 
@@ -112,21 +168,69 @@ std::set<NFAState *> NFA::move(const std::set<NFAState *> &states, char symbol)
   std::set<NFAState *> result;
 
   for (NFAState *state : states) {
-    for (auto &trans : transitions) {
-      if (trans.from == state) {
-        if (trans.isCharClass &&
-            trans.charClass.find(symbol) != trans.charClass.end()) {
-          result.insert(trans.to);
-        } else if (!trans.isCharClass && trans.symbol == symbol) {
-          result.insert(trans.to);
-        }
+    for (int index : symbolEdges[state->id]) {
+      if (transitions[index].matches(symbol))
+        result.insert(transitions[index].to);
+    }
+  }
+
+  return result;
+}
+
+void NFA::epsilonClosure(StateSet &set)
+{
+  if (!closures.empty()) {
+    StateSet result = set;
+    set.forEach([&](int id) { result.unionWith(closures[id]); });
+    set = std::move(result);
+    return;
+  }
+
+  std::vector<int> stack;
+  set.forEach([&](int id) { stack.push_back(id); });
+
+  while (!stack.empty()) {
+    int current = stack.back();
+    stack.pop_back();
+
+    for (int index : epsilonEdges[current]) {
+      int to = transitions[index].to->id;
+      if (!set.contains(to)) {
+        set.insert(to);
+        stack.push_back(to);
       }
     }
   }
+}
+
+StateSet NFA::move(const StateSet &set, char symbol)
+{
+  StateSet result(states.size());
+
+  set.forEach([&](int id) {
+    for (int index : symbolEdges[id]) {
+      if (transitions[index].matches(symbol))
+        result.insert(transitions[index].to->id);
+    }
+  });
 
   return result;
 }
 
+NFAState *NFA::acceptingState(const StateSet &set) const
+{
+  NFAState *best = nullptr;
+
+  set.forEach([&](int id) {
+    NFAState *state = states[id].get();
+    if (state->isAccept &&
+        (!best || state->tokenPriority < best->tokenPriority))
+      best = state;
+  });
+
+  return best;
+}
+
 std::set<char> NFA::getAlphabet()
 {
   std::set<char> alphabet;
@@ -141,28 +245,27 @@ std::set<char> NFA::getAlphabet()
   return alphabet;
 }
 
+ByteClasses NFA::getByteClasses()
+{
+  ByteClasses classes;
+
+  for (const auto &trans : transitions) {
+    if (trans.isCharClass)
+      classes.refine(trans.charClass);
+    else if (trans.symbol != EPSILON)
+      classes.refine(std::set<char>{ trans.symbol });
+  }
+
+  return classes;
+}
+
 bool NFA::matches(const std::string &input)
 {
   std::set<NFAState *> currentStates = { startState };
   currentStates = epsilonClosure(currentStates);
 
   for (char c : input) {
-    std::set<NFAState *> nextStates;
-
-    for (NFAState *state : currentStates) {
-      for (auto &trans : transitions) {
-        if (trans.from == state) {
-          if (trans.isCharClass &&
-              trans.charClass.find(c) != trans.charClass.end()) {
-            nextStates.insert(trans.to);
-          } else if (!trans.isCharClass && trans.symbol == c) {
-            nextStates.insert(trans.to);
-          }
-        }
-      }
-    }
-
-    currentStates = epsilonClosure(nextStates);
+    currentStates = epsilonClosure(move(currentStates, c));
 
     if (currentStates.empty()) {
       return false;
@@ -3,6 +3,8 @@
 
 #include "./regex_parser.hpp"
 #include <memory>
+#include <climits>
+#include <cstdint>
 #include <optional>
 #include <set>
 
@@ -17,6 +19,48 @@ public:
   NFAState(int id) : id(id), isAccept(false) {}
 };
 
+// dense set of nfa states, one bit per NFAState::id (or per position in the
+// followpos construction). used as the key of subset construction so lookups
+// hash and compare whole words instead of walking ordered sets of pointers
+class StateSet
+{
+private:
+  std::vector<uint64_t> words;
+
+public:
+  StateSet() {}
+  explicit StateSet(size_t capacity) : words((capacity + 63) / 64, 0) {}
+
+  void insert(int id) { words[id >> 6] |= uint64_t(1) << (id & 63); }
+  bool contains(int id) const
+  {
+    return (words[id >> 6] >> (id & 63)) & 1;
+  }
+
+  bool empty() const;
+  size_t hash() const;
+
+  void unionWith(const StateSet &other);
+
+  // calls f(id) for every state in the set, in increasing id order
+  template <typename F> void forEach(F f) const
+  {
+    for (size_t w = 0; w < words.size(); w++) {
+      uint64_t bits = words[w];
+      while (bits) {
+        f(static_cast<int>(w * 64 + __builtin_ctzll(bits)));
+        bits &= bits - 1;
+      }
+    }
+  }
+
+  bool operator==(const StateSet &other) const { return words == other.words; }
+};
+
+struct StateSetHash {
+  size_t operator()(const StateSet &set) const { return set.hash(); }
+};
+
 // represent e-moves in NFATransition
 const char EPSILON = '\0';
 
@@ -56,14 +100,43 @@ private:
   std::vector<NFATransition> transitions;
   int nextStateId; // used when added new states
 
+  // outgoing transitions of each state (indices into transitions), indexed
+  // by NFAState::id and split into e-moves and symbol moves
+  std::vector<std::vector<int>> epsilonEdges;
+  std::vector<std::vector<int>> symbolEdges;
+
+  // epsilon closure of every single state, filled by computeClosures() and
+  // dropped whenever the nfa changes
+  std::vector<StateSet> closures;
+
+  // print every added transition, off by default
+  bool trace;
+
+  void indexTransition(int index);
+  void checkTransition(const NFAState *from, const NFAState *to) const;
+
 public:
   NFAState *startState;
   NFAState *acceptState;
 
-  NFA() : nextStateId(0), startState(nullptr), acceptState(nullptr) {}
+  NFA()
+      : nextStateId(0), trace(false), startState(nullptr),
+        acceptState(nullptr)
+  {
+  }
 
+  // the returned pointer is the handle used to add transitions, it stays
+  // valid for the lifetime of the nfa
   NFAState *createState();
 
+  // true if the state was created by this nfa, O(1)
+  bool ownsState(const NFAState *state) const;
+
+  void setTrace(bool enabled) { trace = enabled; }
+
+  size_t stateCount() const { return states.size(); }
+  NFAState *getState(int id) const { return states[id].get(); }
+
   void addTransition(NFAState *from, NFAState *to, char symb);
   void addTransition(NFAState *from,
                      NFAState *to,
@@ -72,15 +145,29 @@ public:
   // get transitions from specific state
   std::vector<NFATransition *> getTransitions(NFAState *state);
 
+  // memoize the epsilon closure of each state, call once construction is done
+  void computeClosures();
+
   // get epsilon closure of set of states
   std::set<NFAState *> epsilonClosure(const std::set<NFAState *> &states);
 
   // simulate move on set of states given input symbol
   std::set<NFAState *> move(const std::set<NFAState *> &states, char symbol);
 
+  // bitset versions of the above, used by subset construction
+  void epsilonClosure(StateSet &states);
+  StateSet move(const StateSet &states, char symbol);
+
+  // the accepting state whose token wins in a set of states: the lowest
+  // tokenPriority, ties go to the lowest id. nullptr if none accepts
+  NFAState *acceptingState(const StateSet &states) const;
+
   // get alphabet (excluding e)
   std::set<char> getAlphabet();
 
+  // get the byte classes that the transitions can tell apart
+  ByteClasses getByteClasses();
+
   // simulate nfa on string
   bool matches(const std::string &input);
 
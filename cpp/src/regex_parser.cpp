@@ -338,6 +338,46 @@ std::shared_ptr<ASTNode> RegexParser::parseAtom()
   throw std::runtime_error("unexpected token");
 }
 
+ByteClasses::ByteClasses() : representatives{ 0 } { classOf.fill(0); }
+
+void ByteClasses::refine(const std::set<char> &chars)
+{
+  std::array<bool, 256> inSet{};
+  for (char c : chars)
+    inSet[static_cast<unsigned char>(c)] = true;
+
+  // split every class into the bytes inside and outside the set, then
+  // renumber classes by their smallest byte so the result is canonical
+  std::array<int, 256> splitOf;
+  for (int b = 0; b < 256; b++)
+    splitOf[b] = classOf[b] * 2 + (inSet[b] ? 1 : 0);
+
+  std::vector<int> renumber(representatives.size() * 2, -1);
+  representatives.clear();
+  for (int b = 0; b < 256; b++) {
+    int &id = renumber[splitOf[b]];
+    if (id == -1) {
+      id = representatives.size();
+      representatives.push_back(static_cast<unsigned char>(b));
+    }
+    classOf[b] = id;
+  }
+}
+
+void ByteClasses::refine(const std::shared_ptr<ASTNode> &node)
+{
+  if (!node)
+    return;
+
+  if (node->type == NodeType::CHAR)
+    refine(std::set<char>{ node->value });
+  else if (node->type == NodeType::CHAR_CLASS)
+    refine(node->charClass);
+
+  refine(node->left);
+  refine(node->right);
+}
+
 std::string charToString(char c)
 {
   switch (c) {
@@ -1,6 +1,7 @@
 #ifndef REGEX_PARSER_HPP
 #define REGEX_PARSER_HPP
 
+#include <array>
 #include <memory>
 #include <set>
 #include <string>
@@ -62,6 +63,21 @@ struct ASTNode {
   ASTNode(NodeType t, const std::set<char> &cc) : type(t), charClass(cc) {}
 };
 
+// partition of the 256 byte values into classes that no pattern can tell
+// apart. starts as a single class and is refined with the characters of
+// every CHAR and CHAR_CLASS node, so automata only need one column per class
+struct ByteClasses {
+  std::array<int, 256> classOf;
+  std::vector<unsigned char> representatives; // smallest byte of each class
+
+  ByteClasses();
+
+  int count() const { return static_cast<int>(representatives.size()); }
+
+  void refine(const std::set<char> &chars);
+  void refine(const std::shared_ptr<ASTNode> &node);
+};
+
 class RegexLexer
 {
 private:
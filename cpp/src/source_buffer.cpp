@@ -0,0 +1,88 @@
+#include "./source_buffer.hpp"
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+void SourceBuffer::release()
+{
+  if (mapping)
+    munmap(mapping, mappingSize);
+  mapping = nullptr;
+  mappingSize = 0;
+  buffer.clear();
+  text = "";
+  textSize = 0;
+}
+
+bool SourceBuffer::map(int fd, size_t size)
+{
+  // reserve at least one byte past the file, zero filled, and map the file
+  // over the front of it. the bytes after the end of the file in its last
+  // page read as zero as well, so the sentinel costs no copy
+  size_t page = sysconf(_SC_PAGESIZE);
+  size_t reserved = (size / page + 1) * page;
+  void *addr = mmap(nullptr, reserved, PROT_READ,
+                    MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (addr == MAP_FAILED)
+    return false;
+  if (mmap(addr, size, PROT_READ, MAP_PRIVATE | MAP_FIXED, fd, 0) ==
+      MAP_FAILED) {
+    munmap(addr, reserved);
+    return false;
+  }
+  madvise(addr, size, MADV_SEQUENTIAL);
+
+  mapping = addr;
+  mappingSize = reserved;
+  text = static_cast<const char *>(addr);
+  textSize = size;
+  return true;
+}
+
+bool SourceBuffer::read(int fd)
+{
+  const size_t chunk = 64 * 1024;
+  size_t size = 0;
+  for (;;) {
+    buffer.resize(size + chunk);
+    ssize_t n = ::read(fd, buffer.data() + size, chunk);
+    if (n < 0 && errno == EINTR)
+      continue;
+    if (n < 0)
+      return false;
+    if (n == 0)
+      break;
+    size += n;
+  }
+
+  buffer.resize(size + 1);
+  buffer[size] = '\0';
+  text = buffer.data();
+  textSize = size;
+  return true;
+}
+
+bool SourceBuffer::load(const std::string &path)
+{
+  release();
+
+  bool standardInput = path == "-";
+  int fd = standardInput ? STDIN_FILENO : open(path.c_str(), O_RDONLY);
+  if (fd == -1)
+    return false;
+
+  struct stat st;
+  bool loaded;
+  if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0)
+    loaded = map(fd, st.st_size) || read(fd); // not every file maps
+  else
+    loaded = read(fd);
+
+  if (!standardInput)
+    close(fd);
+  if (!loaded)
+    release();
+  return loaded;
+}
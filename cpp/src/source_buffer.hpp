@@ -0,0 +1,44 @@
+#ifndef SOURCE_BUFFER_HPP
+#define SOURCE_BUFFER_HPP
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+// contents of a source file followed by a NUL sentinel, which is not part of
+// view(). a regular file is mapped read-only and read ahead sequentially, so
+// it is never copied. pipes, stdin and files that report no size, like the
+// ones in /proc, are read into memory instead
+class SourceBuffer
+{
+private:
+  void *mapping;
+  size_t mappingSize;
+  std::vector<char> buffer; // holds the text when it is not mapped
+
+  const char *text;
+  size_t textSize;
+
+  void release();
+  bool map(int fd, size_t size);
+  bool read(int fd);
+
+public:
+  SourceBuffer() : mapping(nullptr), mappingSize(0), text(""), textSize(0) {}
+  ~SourceBuffer() { release(); }
+
+  SourceBuffer(const SourceBuffer &) = delete;
+  SourceBuffer &operator=(const SourceBuffer &) = delete;
+
+  // loads path, or stdin if path is "-". returns false and leaves the buffer
+  // empty if it can't be opened or read
+  bool load(const std::string &path);
+  bool mapped() const { return mapping != nullptr; }
+
+  // text[size()] is always '\0'
+  const char *data() const { return text; }
+  size_t size() const { return textSize; }
+  std::string_view view() const { return { text, textSize }; }
+};
+
+#endif
@@ -0,0 +1,756 @@
+#ifndef STATIC_DFA_HPP
+#define STATIC_DFA_HPP
+
+#include <array>
+#include <bit>
+#include <climits>
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+// a pattern usable in constant expressions, same meaning as RegexPattern
+struct StaticPattern {
+  const char *pattern;
+  const char *tokenType;
+  int priority; // lower value = higher priority
+};
+
+struct StaticTransition {
+  int from;
+  int symbol; // byte class
+  int to;
+};
+
+// automaton built by StaticDFABuilder, with room for Capacity states and
+// transitions so that it fits in a constexpr variable
+template <size_t Capacity>
+struct StaticDFAData {
+  int stateCount;
+  int classCount;
+  int transitionCount;
+  std::array<uint8_t, 256> classOf;
+  std::array<StaticTransition, Capacity> transitions;
+  std::array<int, Capacity> stateTokens; // pattern index, -1 if not accepting
+};
+
+// builds the DFA of a pattern list during constant evaluation. it accepts
+// the same regex syntax as RegexLexer/RegexParser and resolves tokens the
+// same way, so it lexes exactly like the table TransitionTableGenerator
+// produces. the DFA is the followpos construction without minimization. a
+// malformed pattern or an automaton over Capacity fails to compile
+class StaticDFABuilder
+{
+public:
+  using ByteSet = std::array<uint64_t, 4>;
+
+  template <size_t Capacity, typename Patterns>
+  static constexpr StaticDFAData<Capacity> build(const Patterns &patterns)
+  {
+    StaticDFABuilder builder;
+    for (const StaticPattern &pattern : patterns) {
+      builder.patternPriorities.push_back(pattern.priority);
+      builder.roots.push_back(builder.parse(pattern.pattern));
+    }
+
+    builder.buildClasses();
+    builder.buildPositions();
+
+    StaticDFAData<Capacity> data{};
+    builder.buildDFA(data);
+
+    data.classCount = builder.classCount;
+    for (int b = 0; b < 256; b++)
+      data.classOf[b] = builder.classOf[b];
+    return data;
+  }
+
+private:
+  enum class Kind { ATOM, LPAREN, RPAREN, STAR, PLUS, QUESTION, PIPE, END };
+
+  struct Token {
+    Kind kind;
+    ByteSet chars;
+  };
+
+  enum class NodeType { ATOM, CONCAT, UNION, STAR, PLUS, QUESTION };
+
+  struct Node {
+    NodeType type;
+    ByteSet chars;
+    int left;
+    int right;
+  };
+
+  struct Info {
+    bool nullable;
+    std::vector<uint64_t> firstpos;
+    std::vector<uint64_t> lastpos;
+  };
+
+  int classCount = 0;
+  std::array<int, 256> classOf{};
+
+  std::vector<int> patternPriorities;
+  std::vector<Node> nodes;
+  std::vector<int> roots;
+  int leafCount = 0;
+
+  // one position per leaf plus one end marker per pattern
+  std::vector<ByteSet> positionChars;
+  std::vector<int> positionPattern; // pattern index for end markers, else -1
+  std::vector<std::vector<uint64_t>> followpos;
+  std::vector<uint64_t> startPositions;
+  size_t words = 0;
+
+  static constexpr void addByte(ByteSet &set, int b)
+  {
+    set[b >> 6] |= uint64_t(1) << (b & 63);
+  }
+
+  static constexpr bool hasByte(const ByteSet &set, int b)
+  {
+    return (set[b >> 6] >> (b & 63)) & 1;
+  }
+
+  // RegexLexer::expandEscape
+  static constexpr int expandEscape(char c)
+  {
+    switch (c) {
+      case 'n':
+        return '\n';
+      case 't':
+        return '\t';
+      case 'r':
+        return '\r';
+      case 'f':
+        return '\f';
+      case 'v':
+        return '\v';
+      case '0':
+        return '\0';
+      default:
+        return static_cast<unsigned char>(c);
+    }
+  }
+
+  // RegexLexer::getMetaCharClass, negation is over 7-bit ascii
+  static constexpr ByteSet metaCharClass(char c, bool negate)
+  {
+    ByteSet set{};
+    for (int b = 0; b < 128; b++) {
+      bool in = false;
+      if (c == 'd')
+        in = b >= '0' && b <= '9';
+      else if (c == 'w')
+        in = (b >= 'a' && b <= 'z') || (b >= 'A' && b <= 'Z') ||
+            (b >= '0' && b <= '9') || b == '_';
+      else if (c == 's')
+        in = b == ' ' || b == '\r' || b == '\t' || b == '\n' || b == '\f' ||
+            b == '\v';
+      if (in != negate)
+        addByte(set, b);
+    }
+    return set;
+  }
+
+  static constexpr ByteSet single(int b)
+  {
+    ByteSet set{};
+    addByte(set, b);
+    return set;
+  }
+
+  static constexpr Token literal(int b)
+  {
+    return Token{ Kind::ATOM, single(b) };
+  }
+
+  static constexpr bool isMeta(char c)
+  {
+    return c == 'd' || c == 'w' || c == 's';
+  }
+
+  static constexpr bool isNegatedMeta(char c)
+  {
+    return c == 'D' || c == 'W' || c == 'S';
+  }
+
+  // RegexLexer::parseCharacterClass
+  static constexpr ByteSet charClass(std::string_view input, size_t &pos)
+  {
+    pos++; // consume '['
+    ByteSet chars{};
+    bool negated = false;
+
+    if (pos < input.size() && input[pos] == '^') {
+      negated = true;
+      pos++;
+    }
+
+    while (pos < input.size() && input[pos] != ']') {
+      int start = static_cast<unsigned char>(input[pos]);
+
+      if (input[pos] == '\\') {
+        pos++;
+        if (pos >= input.size())
+          break;
+        char next = input[pos];
+        if (isMeta(next) || isNegatedMeta(next)) {
+          ByteSet meta = metaCharClass(next | 0x20, isNegatedMeta(next));
+          for (int w = 0; w < 4; w++)
+            chars[w] |= meta[w];
+          pos++;
+          continue;
+        }
+        start = expandEscape(next);
+        pos++;
+      } else {
+        pos++;
+      }
+
+      if (pos < input.size() && input[pos] == '-' && pos + 1 < input.size()) {
+        pos++; // skip '-'
+
+        int end;
+        if (input[pos] == '\\') {
+          pos++;
+          if (pos >= input.size())
+            break;
+          end = expandEscape(input[pos]);
+          pos++;
+        } else {
+          end = static_cast<unsigned char>(input[pos]);
+          pos++;
+        }
+
+        for (int b = start; b <= end; b++)
+          addByte(chars, b);
+      } else {
+        addByte(chars, start);
+      }
+    }
+
+    if (pos < input.size() && input[pos] == ']')
+      pos++;
+
+    if (negated) {
+      ByteSet negatedChars{};
+      for (int b = 0; b < 128; b++) {
+        if (!hasByte(chars, b))
+          addByte(negatedChars, b);
+      }
+      chars = negatedChars;
+    }
+    return chars;
+  }
+
+  // RegexLexer::tokenize
+  static constexpr std::vector<Token> tokenize(std::string_view input)
+  {
+    std::vector<Token> tokens;
+    size_t pos = 0;
+
+    while (pos < input.size()) {
+      char c = input[pos];
+
+      if (c == '(') {
+        tokens.push_back(Token{ Kind::LPAREN, {} });
+        pos++;
+      } else if (c == ')') {
+        tokens.push_back(Token{ Kind::RPAREN, {} });
+        pos++;
+      } else if (c == '*') {
+        tokens.push_back(Token{ Kind::STAR, {} });
+        pos++;
+      } else if (c == '|') {
+        tokens.push_back(Token{ Kind::PIPE, {} });
+        pos++;
+      } else if (c == '+') {
+        tokens.push_back(Token{ Kind::PLUS, {} });
+        pos++;
+      } else if (c == '?') {
+        tokens.push_back(Token{ Kind::QUESTION, {} });
+        pos++;
+      } else if (c == '[') {
+        tokens.push_back(Token{ Kind::ATOM, charClass(input, pos) });
+      } else if (c == '"') {
+        // quoted literal sequence, escapes expand to literal characters
+        pos++;
+        while (pos < input.size() && input[pos] != '"') {
+          if (input[pos] == '\\') {
+            pos++;
+            if (pos >= input.size())
+              break;
+            tokens.push_back(literal(expandEscape(input[pos])));
+            pos++;
+          } else {
+            tokens.push_back(literal(static_cast<unsigned char>(input[pos])));
+            pos++;
+          }
+        }
+        if (pos < input.size() && input[pos] == '"')
+          pos++;
+      } else if (c == '\\') {
+        pos++;
+        if (pos < input.size()) {
+          char next = input[pos];
+          if (isMeta(next) || isNegatedMeta(next))
+            tokens.push_back(Token{
+                Kind::ATOM, metaCharClass(next | 0x20, isNegatedMeta(next)) });
+          else
+            tokens.push_back(literal(expandEscape(next)));
+          pos++;
+        }
+      } else {
+        tokens.push_back(literal(static_cast<unsigned char>(c)));
+        pos++;
+      }
+    }
+
+    tokens.push_back(Token{ Kind::END, {} });
+    return tokens;
+  }
+
+  constexpr int addNode(NodeType type, int left, int right = -1)
+  {
+    nodes.push_back(Node{ type, {}, left, right });
+    return nodes.size() - 1;
+  }
+
+  // RegexParser, recursive descent over the token list
+  constexpr int parseUnion(const std::vector<Token> &tokens, size_t &pos)
+  {
+    int left = parseConcat(tokens, pos);
+    while (tokens[pos].kind == Kind::PIPE) {
+      pos++;
+      int right = parseConcat(tokens, pos);
+      left = addNode(NodeType::UNION, left, right);
+    }
+    return left;
+  }
+
+  constexpr int parseConcat(const std::vector<Token> &tokens, size_t &pos)
+  {
+    int left = parseClosure(tokens, pos);
+    while (tokens[pos].kind == Kind::ATOM || tokens[pos].kind == Kind::LPAREN) {
+      int right = parseClosure(tokens, pos);
+      left = addNode(NodeType::CONCAT, left, right);
+    }
+    return left;
+  }
+
+  constexpr int parseClosure(const std::vector<Token> &tokens, size_t &pos)
+  {
+    int node = parseAtom(tokens, pos);
+    while (true) {
+      Kind kind = tokens[pos].kind;
+      if (kind == Kind::STAR)
+        node = addNode(NodeType::STAR, node);
+      else if (kind == Kind::PLUS)
+        node = addNode(NodeType::PLUS, node);
+      else if (kind == Kind::QUESTION)
+        node = addNode(NodeType::QUESTION, node);
+      else
+        break;
+      pos++;
+    }
+    return node;
+  }
+
+  constexpr int parseAtom(const std::vector<Token> &tokens, size_t &pos)
+  {
+    const Token &token = tokens[pos];
+    if (token.kind == Kind::ATOM) {
+      pos++;
+      nodes.push_back(Node{ NodeType::ATOM, token.chars, -1, -1 });
+      leafCount++;
+      return nodes.size() - 1;
+    }
+    if (token.kind == Kind::LPAREN) {
+      pos++;
+      int node = parseUnion(tokens, pos);
+      if (tokens[pos].kind == Kind::RPAREN)
+        pos++;
+      return node;
+    }
+    throw std::logic_error("unexpected token");
+  }
+
+  constexpr int parse(const char *pattern)
+  {
+    std::vector<Token> tokens = tokenize(pattern);
+    size_t pos = 0;
+    return parseUnion(tokens, pos);
+  }
+
+  // same partition as refining ByteClasses with every leaf, numbered by
+  // smallest byte. a leaf only visits its own bytes: those move from their
+  // class to a fresh id, and the ids are compacted at the end
+  constexpr void buildClasses()
+  {
+    int idCount = 1;
+    std::vector<int> splitTo(1, -1); // id the current leaf's bytes move to
+    std::vector<int> split;
+    for (const Node &node : nodes) {
+      if (node.type != NodeType::ATOM)
+        continue;
+
+      for (int w = 0; w < 4; w++) {
+        for (uint64_t bits = node.chars[w]; bits; bits &= bits - 1) {
+          int b = w * 64 + std::countr_zero(bits);
+          int id = classOf[b];
+          if (splitTo[id] == -1) {
+            splitTo[id] = idCount++;
+            splitTo.push_back(-1);
+            split.push_back(id);
+          }
+          classOf[b] = splitTo[id];
+        }
+      }
+
+      for (int id : split)
+        splitTo[id] = -1;
+      split.clear();
+    }
+
+    std::vector<int> renumber(idCount, -1);
+    classCount = 0;
+    for (int b = 0; b < 256; b++) {
+      int &id = renumber[classOf[b]];
+      if (id == -1)
+        id = classCount++;
+      classOf[b] = id;
+    }
+  }
+
+  constexpr std::vector<uint64_t> emptySet() const
+  {
+    return std::vector<uint64_t>(words, 0);
+  }
+
+  static constexpr void unite(std::vector<uint64_t> &to,
+                              const std::vector<uint64_t> &from)
+  {
+    for (size_t w = 0; w < to.size(); w++)
+      to[w] |= from[w];
+  }
+
+  static constexpr void insert(std::vector<uint64_t> &set, int p)
+  {
+    set[p >> 6] |= uint64_t(1) << (p & 63);
+  }
+
+  constexpr void addFollow(const std::vector<uint64_t> &from,
+                           const std::vector<uint64_t> &to)
+  {
+    for (size_t w = 0; w < from.size(); w++) {
+      for (uint64_t bits = from[w]; bits; bits &= bits - 1)
+        unite(followpos[w * 64 + std::countr_zero(bits)], to);
+    }
+  }
+
+  // nullable, firstpos and lastpos of a subtree, filling in followpos
+  constexpr Info analyze(int id)
+  {
+    const Node &node = nodes[id];
+    Info info{ false, emptySet(), emptySet() };
+
+    if (node.type == NodeType::ATOM) {
+      int p = positionChars.size();
+      positionChars.push_back(node.chars);
+      positionPattern.push_back(-1);
+      insert(info.firstpos, p);
+      insert(info.lastpos, p);
+      return info;
+    }
+
+    Info left = analyze(node.left);
+    if (node.type == NodeType::CONCAT || node.type == NodeType::UNION) {
+      Info right = analyze(node.right);
+      info.firstpos = left.firstpos;
+      info.lastpos = right.lastpos;
+      if (node.type == NodeType::CONCAT) {
+        addFollow(left.lastpos, right.firstpos);
+        info.nullable = left.nullable && right.nullable;
+        if (left.nullable)
+          unite(info.firstpos, right.firstpos);
+        if (right.nullable)
+          unite(info.lastpos, left.lastpos);
+      } else {
+        info.nullable = left.nullable || right.nullable;
+        unite(info.firstpos, right.firstpos);
+        unite(info.lastpos, left.lastpos);
+      }
+      return info;
+    }
+
+    if (node.type != NodeType::QUESTION)
+      addFollow(left.lastpos, left.firstpos);
+    info.nullable = node.type != NodeType::PLUS || left.nullable;
+    info.firstpos = left.firstpos;
+    info.lastpos = left.lastpos;
+    return info;
+  }
+
+  constexpr void buildPositions()
+  {
+    int total = leafCount + roots.size();
+    words = (total + 63) / 64;
+    followpos.assign(total, emptySet());
+    startPositions = emptySet();
+
+    for (size_t k = 0; k < roots.size(); k++) {
+      Info info = analyze(roots[k]);
+
+      int end = positionChars.size();
+      positionChars.push_back(ByteSet{});
+      positionPattern.push_back(k);
+
+      std::vector<uint64_t> endSet = emptySet();
+      insert(endSet, end);
+      addFollow(info.lastpos, endSet);
+
+      unite(startPositions, info.firstpos);
+      if (info.nullable)
+        insert(startPositions, end);
+    }
+  }
+
+  static constexpr uint64_t hashSet(const uint64_t *set, size_t count)
+  {
+    uint64_t hash = 14695981039346656037ULL;
+    for (size_t w = 0; w < count; w++) {
+      hash ^= set[w];
+      // the multiply only carries upwards, mix the high bits back into the
+      // low ones the bucket mask keeps
+      hash ^= hash >> 33;
+      hash *= 0xff51afd7ed558ccdULL;
+      hash ^= hash >> 33;
+    }
+    return hash;
+  }
+
+  // subset construction over position sets, mirrors FollowposConstruction
+  template <typename Data>
+  constexpr void buildDFA(Data &out)
+  {
+    // classes each leaf position matches, as a list and as a bitmask.
+    // end markers match nothing
+    std::vector<std::vector<int>> positionClasses(positionChars.size());
+    std::vector<ByteSet> positionClassSet(positionChars.size());
+    for (size_t p = 0; p < positionChars.size(); p++) {
+      for (int w = 0; w < 4; w++) {
+        for (uint64_t bits = positionChars[p][w]; bits; bits &= bits - 1) {
+          int c = classOf[w * 64 + std::countr_zero(bits)];
+          if (!hasByte(positionClassSet[p], c)) {
+            addByte(positionClassSet[p], c);
+            positionClasses[p].push_back(c);
+          }
+        }
+      }
+    }
+
+    const int capacity = out.transitions.size();
+    int stateCount = 0;
+    std::vector<uint64_t> sets; // words per state, concatenated
+    std::vector<int> buckets(64, -1); // open addressing over state ids
+
+    // interns the set at from[offset, offset + words)
+    auto findOrAdd = [&](const std::vector<uint64_t> &from, size_t offset) {
+      size_t candidate = stateCount;
+      const uint64_t *set = from.data() + offset;
+      size_t mask = buckets.size() - 1;
+      size_t slot = hashSet(set, words) & mask;
+      while (buckets[slot] != -1) {
+        size_t other = buckets[slot];
+        const uint64_t *otherSet = sets.data() + other * words;
+        bool same = true;
+        for (size_t w = 0; w < words && same; w++)
+          same = otherSet[w] == set[w];
+        if (same)
+          return static_cast<int>(other);
+        slot = (slot + 1) & mask;
+      }
+
+      sets.insert(sets.end(), from.begin() + offset,
+                  from.begin() + offset + words);
+
+      if (stateCount == capacity)
+        throw std::length_error("StaticDFA capacity exceeded");
+      buckets[slot] = candidate;
+      stateCount++;
+
+      // lowest priority value wins, ties go to the earlier pattern
+      int token = -1;
+      for (size_t w = 0; w < words; w++) {
+        for (uint64_t bits = sets[candidate * words + w]; bits;
+             bits &= bits - 1) {
+          int k = positionPattern[w * 64 + std::countr_zero(bits)];
+          if (k != -1 &&
+              (token == -1 || patternPriorities[k] < patternPriorities[token]))
+            token = k;
+        }
+      }
+      out.stateTokens[candidate] = token;
+
+      // keep the load factor under one half
+      if (stateCount * 2 > static_cast<int>(buckets.size())) {
+        buckets.assign(buckets.size() * 2, -1);
+        mask = buckets.size() - 1;
+        for (int s = 0; s < stateCount; s++) {
+          size_t at = hashSet(sets.data() + s * words, words) & mask;
+          while (buckets[at] != -1)
+            at = (at + 1) & mask;
+          buckets[at] = s;
+        }
+      }
+      return static_cast<int>(candidate);
+    };
+
+    findOrAdd(startPositions, 0);
+
+    // classes matched by the same positions of a state lead to the same
+    // target, so each state splits its classes into groups and builds and
+    // interns one target per group. usually most of the alphabet lands in a
+    // single group, such as the letters continuing an identifier. the word
+    // loops go through raw pointers, vector indexing is far more expensive
+    // during constant evaluation
+    std::vector<uint64_t> target(words, 0);
+    std::vector<int> group(classCount, 0);
+    std::vector<int> touched(classCount); // classes matched by some position
+    int touchedCount = 0;
+    std::vector<int> splitTo; // per group, where its classes matching p go
+    std::vector<int> splitStamp;
+    std::vector<int> groupTarget; // per group, interned target state
+    int stamp = 0;
+
+    for (int state = 0; state < stateCount; state++) {
+      int groupCount = 1;
+      for (size_t w = 0; w < words; w++) {
+        for (uint64_t bits = sets[state * words + w]; bits;
+             bits &= bits - 1) {
+          int p = w * 64 + std::countr_zero(bits);
+          stamp++;
+          for (int c : positionClasses[p]) {
+            int g = group[c];
+            if (g == 0)
+              touched[touchedCount++] = c;
+            if (g >= static_cast<int>(splitStamp.size()) ||
+                splitStamp[g] != stamp) {
+              if (g >= static_cast<int>(splitStamp.size())) {
+                splitStamp.resize(g + 1, 0);
+                splitTo.resize(g + 1, 0);
+              }
+              splitStamp[g] = stamp;
+              splitTo[g] = groupCount++;
+            }
+            group[c] = splitTo[g];
+          }
+        }
+      }
+
+      groupTarget.assign(groupCount, -1);
+      for (int i = 0; i < touchedCount; i++) {
+        int c = touched[i];
+        int g = group[c];
+        if (groupTarget[g] == -1) {
+          uint64_t *to = target.data();
+          for (size_t x = 0; x < words; x++)
+            to[x] = 0;
+          for (size_t w = 0; w < words; w++) {
+            for (uint64_t bits = sets[state * words + w]; bits;
+                 bits &= bits - 1) {
+              int p = w * 64 + std::countr_zero(bits);
+              if (!hasByte(positionClassSet[p], c))
+                continue;
+              const uint64_t *follow = followpos[p].data();
+              for (size_t x = 0; x < words; x++)
+                to[x] |= follow[x];
+            }
+          }
+          groupTarget[g] = findOrAdd(target, 0);
+        }
+        if (out.transitionCount == capacity)
+          throw std::length_error("StaticDFA capacity exceeded");
+        out.transitions[out.transitionCount++] =
+            StaticTransition{ state, c, groupTarget[g] };
+        group[c] = 0;
+      }
+      touchedCount = 0;
+    }
+    out.stateCount = stateCount;
+  }
+};
+
+// the lexing automaton of a pattern list, computed entirely at compile time
+// and stored in read-only data. Patterns is a constexpr array of
+// StaticPattern with static storage duration, Capacity bounds the states and
+// transitions the build may create. offers the stepping interface used by
+// TableDrivenLexer::scan:
+//
+//   static constexpr StaticPattern patterns[] = { ... };
+//   TableDrivenLexer lexer;
+//   lexer.scan(StaticDFA<patterns>(), input);
+template <const auto &Patterns, size_t Capacity = 16384>
+class StaticDFA
+{
+private:
+  // built once, only the sized tables below end up in the binary
+  static constexpr StaticDFAData<Capacity> data =
+      StaticDFABuilder::build<Capacity>(Patterns);
+
+public:
+  static constexpr int classCount = data.classCount;
+
+  // narrowest type that holds every state id and -1
+  using StateId = std::conditional_t<
+      data.stateCount <= INT8_MAX,
+      int8_t,
+      std::conditional_t<data.stateCount <= INT16_MAX, int16_t, int32_t>>;
+
+private:
+  struct Tables {
+    std::array<uint8_t, 256> classOf;
+    std::array<StateId, data.stateCount * classCount> next;
+    std::array<int16_t, data.stateCount> tokens;
+  };
+
+  static constexpr Tables tables = [] {
+    Tables t{};
+    t.classOf = data.classOf;
+    for (StateId &to : t.next)
+      to = -1;
+    for (int i = 0; i < data.transitionCount; i++) {
+      const StaticTransition &trans = data.transitions[i];
+      t.next[trans.from * classCount + trans.symbol] = trans.to;
+    }
+    for (int s = 0; s < data.stateCount; s++)
+      t.tokens[s] = data.stateTokens[s];
+    return t;
+  }();
+
+public:
+  static constexpr size_t stateCount() { return data.stateCount; }
+  static constexpr int start() { return 0; }
+
+  // next state on byte c, -1 if there is none
+  static constexpr int next(int state, char c)
+  {
+    return tables.next[state * classCount +
+                       tables.classOf[static_cast<unsigned char>(c)]];
+  }
+
+  static constexpr bool isAccept(int state)
+  {
+    return tables.tokens[state] != -1;
+  }
+
+  static constexpr std::string_view tokenType(int state)
+  {
+    return Patterns[tables.tokens[state]].tokenType;
+  }
+};
+
+#endif
@@ -0,0 +1,210 @@
+#include "./table_image.hpp"
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <map>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static const char MAGIC[8] = { 'T', 'D', 'L', 'X', 'T', 'B', 'L', '\0' };
+
+// 64-bit FNV-1a, chained through seed
+static uint64_t fnv1a(const void *data, size_t size,
+                      uint64_t seed = 14695981039346656037ULL)
+{
+  const unsigned char *bytes = static_cast<const unsigned char *>(data);
+  uint64_t hash = seed;
+  for (size_t i = 0; i < size; i++) {
+    hash ^= bytes[i];
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+uint64_t hashPatterns(const std::vector<RegexPattern> &patterns,
+                      uint32_t variant)
+{
+  uint64_t hash = fnv1a(&TableImage::VERSION, sizeof(TableImage::VERSION));
+  hash = fnv1a(&variant, sizeof(variant), hash);
+  for (const auto &pattern : patterns) {
+    // sizes keep ("ab", "c") and ("a", "bc") apart
+    uint64_t sizes[2] = { pattern.pattern.size(), pattern.tokenType.size() };
+    hash = fnv1a(sizes, sizeof(sizes), hash);
+    hash = fnv1a(pattern.pattern.data(), pattern.pattern.size(), hash);
+    hash = fnv1a(pattern.tokenType.data(), pattern.tokenType.size(), hash);
+    hash = fnv1a(&pattern.priority, sizeof(pattern.priority), hash);
+  }
+  return hash;
+}
+
+bool TableImage::write(const TransitionTable &table,
+                       uint64_t patternHash,
+                       const std::string &path)
+{
+  uint32_t stateCount = table.stateCount();
+  uint32_t classCount = table.columnCount();
+
+  std::vector<uint8_t> classOf(table.columnOf.begin(), table.columnOf.end());
+  std::vector<int32_t> rows(table.transitions.begin(),
+                            table.transitions.end());
+
+  // token ids are assigned in order of first appearance
+  std::map<std::string, int32_t> tokenIds;
+  std::string tokenNames;
+  std::vector<int32_t> stateTokens(stateCount, -1);
+  for (uint32_t id = 0; id < stateCount; id++) {
+    if (!table.isAccept(id))
+      continue;
+    const std::string &type = table.tokenType(id);
+    auto it = tokenIds.find(type);
+    if (it == tokenIds.end()) {
+      it = tokenIds.emplace(type, tokenIds.size()).first;
+      tokenNames += type;
+      tokenNames += '\0';
+    }
+    stateTokens[id] = it->second;
+  }
+
+  TableImageHeader header = {};
+  std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+  header.version = VERSION;
+  header.stateCount = stateCount;
+  header.classCount = classCount;
+  header.startState = table.startStateId;
+  header.tokenCount = tokenIds.size();
+  header.tokenNamesSize = tokenNames.size();
+  header.patternHash = patternHash;
+
+  uint64_t checksum = fnv1a(classOf.data(), classOf.size());
+  checksum = fnv1a(rows.data(), rows.size() * sizeof(int32_t), checksum);
+  checksum = fnv1a(stateTokens.data(),
+                   stateTokens.size() * sizeof(int32_t),
+                   checksum);
+  checksum = fnv1a(tokenNames.data(), tokenNames.size(), checksum);
+  header.checksum = checksum;
+
+  // write to a temporary name first so a reader never maps a partial file
+  std::string tmpPath = path + ".tmp";
+  std::ofstream out(tmpPath, std::ios::binary | std::ios::trunc);
+  if (!out)
+    return false;
+
+  out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+  out.write(reinterpret_cast<const char *>(classOf.data()), classOf.size());
+  out.write(reinterpret_cast<const char *>(rows.data()),
+            rows.size() * sizeof(int32_t));
+  out.write(reinterpret_cast<const char *>(stateTokens.data()),
+            stateTokens.size() * sizeof(int32_t));
+  out.write(tokenNames.data(), tokenNames.size());
+  out.close();
+
+  if (!out) {
+    std::remove(tmpPath.c_str());
+    return false;
+  }
+  return std::rename(tmpPath.c_str(), path.c_str()) == 0;
+}
+
+void TableImage::unmap()
+{
+  if (mapping)
+    munmap(mapping, mappingSize);
+  mapping = nullptr;
+  mappingSize = 0;
+  header = nullptr;
+  tokenNames.clear();
+  accelerators.clear();
+}
+
+bool TableImage::load(const std::string &path)
+{
+  unmap();
+
+  int fd = open(path.c_str(), O_RDONLY);
+  if (fd == -1)
+    return false;
+
+  struct stat st;
+  if (fstat(fd, &st) == -1 || st.st_size < (off_t)sizeof(TableImageHeader)) {
+    close(fd);
+    return false;
+  }
+
+  void *addr = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (addr == MAP_FAILED)
+    return false;
+
+  mapping = addr;
+  mappingSize = st.st_size;
+
+  const char *base = static_cast<const char *>(addr);
+  const TableImageHeader *h = reinterpret_cast<const TableImageHeader *>(base);
+  if (std::memcmp(h->magic, MAGIC, sizeof(MAGIC)) != 0 ||
+      h->version != VERSION) {
+    unmap();
+    return false;
+  }
+
+  uint64_t cells = (uint64_t)h->stateCount * h->classCount;
+  uint64_t expectedSize = sizeof(TableImageHeader) + 256 +
+      cells * sizeof(int32_t) + h->stateCount * sizeof(int32_t) +
+      h->tokenNamesSize;
+  if (expectedSize != mappingSize ||
+      fnv1a(base + sizeof(TableImageHeader),
+            mappingSize - sizeof(TableImageHeader)) != h->checksum) {
+    unmap();
+    return false;
+  }
+
+  const uint8_t *bytes = reinterpret_cast<const uint8_t *>(base) +
+      sizeof(TableImageHeader);
+  const uint8_t *classes = bytes;
+  const int32_t *rowData = reinterpret_cast<const int32_t *>(bytes + 256);
+  const int32_t *tokenData = rowData + cells;
+  const char *names = reinterpret_cast<const char *>(tokenData +
+                                                     h->stateCount);
+
+  // the checksum only catches corruption, a well formed image must also
+  // stay in bounds when the lexer indexes it without checks
+  bool valid = h->startState >= 0 &&
+      (uint32_t)h->startState < h->stateCount;
+  for (int b = 0; b < 256 && valid; b++)
+    valid = classes[b] < h->classCount;
+  for (uint64_t i = 0; i < cells && valid; i++)
+    valid = rowData[i] >= -1 && rowData[i] < (int32_t)h->stateCount;
+  for (uint32_t i = 0; i < h->stateCount && valid; i++)
+    valid = tokenData[i] >= -1 && tokenData[i] < (int32_t)h->tokenCount;
+  if (valid && h->tokenNamesSize > 0)
+    valid = names[h->tokenNamesSize - 1] == '\0';
+
+  if (valid) {
+    const char *name = names;
+    const char *end = names + h->tokenNamesSize;
+    while (name < end) {
+      tokenNames.emplace_back(name);
+      name += tokenNames.back().size() + 1;
+    }
+    valid = tokenNames.size() == h->tokenCount;
+  }
+
+  if (!valid) {
+    unmap();
+    return false;
+  }
+
+  header = h;
+  classOf = classes;
+  rows = rowData;
+  stateTokens = tokenData;
+
+  for (uint32_t s = 0; s < h->stateCount; s++) {
+    int next[256];
+    for (int b = 0; b < 256; b++)
+      next[b] = rows[s * h->classCount + classes[b]];
+    accelerators.push_back(findAccelerator(s, next));
+  }
+  return true;
+}
@@ -0,0 +1,93 @@
+#ifndef TABLE_IMAGE_HPP
+#define TABLE_IMAGE_HPP
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "./dfa.hpp"
+
+// binary image of a TransitionTable that is mapped into memory and used in
+// place, so a run whose patterns are unchanged skips building the automaton.
+// layout, integers in the byte order of the machine that wrote it:
+//
+//   TableImageHeader
+//   uint8_t  classOf[256]                 byte -> column
+//   int32_t  rows[stateCount * classCount] next state, -1 for none
+//   int32_t  stateTokens[stateCount]      token id, -1 if not accepting
+//   char     tokenNames[]                 tokenCount NUL terminated names
+//
+// the checksum covers everything after the header
+struct TableImageHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t stateCount;
+  uint32_t classCount;
+  int32_t startState;
+  uint32_t tokenCount;
+  uint32_t tokenNamesSize;
+  uint64_t patternHash; // hashPatterns() of the patterns the table came from
+  uint64_t checksum;
+};
+
+class TableImage
+{
+private:
+  void *mapping;
+  size_t mappingSize;
+
+  const TableImageHeader *header;
+  const uint8_t *classOf;
+  const int32_t *rows;
+  const int32_t *stateTokens;
+  std::vector<std::string> tokenNames;
+  // not stored in the image, cheap enough to find again on load
+  std::vector<Accelerator> accelerators;
+
+  void unmap();
+
+public:
+  static constexpr uint32_t VERSION = 1;
+
+  TableImage() : mapping(nullptr), mappingSize(0), header(nullptr) {}
+  ~TableImage() { unmap(); }
+
+  TableImage(const TableImage &) = delete;
+  TableImage &operator=(const TableImage &) = delete;
+
+  // maps the image at path and checks its magic, version, size and
+  // checksum. returns false and leaves the image empty if any check fails
+  bool load(const std::string &path);
+  bool loaded() const { return header != nullptr; }
+  uint64_t patternHash() const { return header->patternHash; }
+
+  // stepping interface shared with TransitionTable, used by TableDrivenLexer
+  size_t stateCount() const { return header->stateCount; }
+  int start() const { return header->startState; }
+  int next(int state, char c) const
+  {
+    return rows[state * header->classCount +
+                classOf[static_cast<unsigned char>(c)]];
+  }
+  bool isAccept(int state) const { return stateTokens[state] != -1; }
+  const std::string &tokenType(int state) const
+  {
+    return tokenNames[stateTokens[state]];
+  }
+  size_t skip(int state, const char *text, size_t size) const
+  {
+    const Accelerator &accelerator = accelerators[state];
+    return accelerator.enabled() ? accelerator.skip(text, size) : 0;
+  }
+
+  // serializes table to path, returns false if the file can't be written
+  static bool write(const TransitionTable &table,
+                    uint64_t patternHash,
+                    const std::string &path);
+};
+
+// hash of the pattern list, stored in the image to detect stale tables.
+// variant is mixed in for generator options that change the emitted files
+uint64_t hashPatterns(const std::vector<RegexPattern> &patterns,
+                      uint32_t variant = 0);
+
+#endif
@@ -0,0 +1,117 @@
+#ifndef TINYAI_PATTERNS_HPP
+#define TINYAI_PATTERNS_HPP
+
+#include <climits>
+#include "./static_dfa.hpp"
+
+// token patterns of TinyAI. main builds its RegexPatterns from this list and
+// StaticDFA<tinyaiPatterns> compiles it into a table at compile time
+inline constexpr StaticPattern tinyaiPatterns[] = {
+  // Keywords (0-19)
+  { "if", "IF_TOK", 0 },
+  { "else", "ELSE_TOK", 1 },
+  { "elif", "ELIF_TOK", 2 },
+  { "for", "FOR_TOK", 3 },
+  { "while", "WHILE_TOK", 4 },
+  { "break", "BREAK_TOK", 5 },
+  { "continue", "CONTINUE_TOK", 6 },
+  { "return", "RETURN_TOK", 7 },
+  { "func", "FUNC_TOK", 8 },
+  { "import", "IMPORT_TOK", 9 },
+  { "from", "FROM_TOK", 10 },
+  { "as", "AS_TOK", 11 },
+  { "print", "PRINT_TOK", 12 },
+  { "in", "IN_TOK", 13 },
+  { "use", "USE_TOK", 14 },
+  { "with", "WITH_TOK", 15 },
+  { "numpy", "NUMPY_TOK", 16 },
+  { "then", "THEN", 17 },
+  { "end", "END", 18 },
+  { "do", "DO", 19 },
+
+  // Data types (20-29)
+  { "int", "INT_TOK", 20 },
+  { "float", "FLOAT_TOK", 21 },
+  { "bool", "BOOL_TOK", 22 },
+  { "char", "CHAR_TOK", 23 },
+  { "string", "STRING_TOK", 24 },
+  { "tensor", "TENSOR_TOK", 25 },
+  { "matrix", "MATRIX_TOK", 26 },
+  { "array", "ARRAY_TOK", 27 },
+  { "void", "VOID_TOK", 28 },
+
+  // lost keyword (29)
+  { "input", "INPUT_TOK", 29 },
+
+  // Math functions (30-49)
+  { "rand", "RAND_TOK", 30 },
+  { "zeros", "ZEROS_TOK", 31 },
+  { "ones", "ONES_TOK", 32 },
+  { "mean", "MEAN_TOK", 33 },
+  { "sum", "SUM_TOK", 34 },
+  { "dot", "DOT_TOK", 35 },
+  { "max", "MAX_TOK", 36 },
+  { "min", "MIN_TOK", 37 },
+  { "std", "STD_TOK", 38 },
+  { "var", "VAR_TOK", 39 },
+
+  // Data handling functions (50-69)
+  { "to_array", "TOARRAY_TOK", 50 },
+  { "read_csv", "READCSV_TOK", 51 },
+  { "to_tensor", "TOTENSOR_TOK", 52 },
+  { "normalize", "NORMALIZE_TOK", 53 },
+  { "flatten", "FLATTEN_TOK", 54 },
+  { "concat", "CONCAT_TOK", 55 },
+  { "slice", "SLICE_TOK", 56 },
+  { "sort", "SORT_TOK", 57 },
+  { "filter", "FILTER_TOK", 58 },
+
+  // Multi-character operators (70-89)
+  { "\\*\\*", "DOUBLE_ASTERISK", 70 },
+  { "==", "EQUAL", 71 },
+  { "<=", "LESS_EQUAL", 72 },
+  { ">=", "GREATER_EQUAL", 73 },
+  { "!=", "NOT_EQUAL", 74 },
+  { "and", "AND", 75 },
+  { "or", "OR", 76 },
+  { "not", "NOT", 77 },
+  { "//", "DOUBLE_SLASH", 78 },
+
+  // Single-character operators (90-109)
+  { "\\+", "PLUS", 90 },
+  { "\\*", "ASTERISK", 91 },
+  { "-", "MINUS", 92 },
+  { "/", "SLASH", 93 },
+  { "=", "ASSIGN", 94 },
+  { "%", "MODULO", 95 },
+  { "<", "LESS_THAN", 96 },
+  { ">", "GREATER_THAN", 97 },
+
+  // Delimiters (110-129)
+  { "\\(", "LEFT_PARENTHESIS", 110 },
+  { "\\)", "RIGHT_PARENTHESIS", 111 },
+  { "\\[", "LEFT_SQUARE_BRACKET", 112 },
+  { "\\]", "RIGHT_SQUARE_BRACKET", 113 },
+  { "\\{", "LEFT_CURLY_BRACE", 114 },
+  { "\\}", "RIGHT_CURLY_BRACE", 115 },
+  { ",", "COMMA", 116 },
+  { ":", "COLON", 117 },
+  { ";", "SEMI_COLON", 118 },
+
+  // Literals (130-149)
+  { "\\\"\\\"\\\"[\\s\\S]*\\\"\\\"\\\"", "MULTILINE_COMMENT", 130 },
+  { "\\\"[^\\\"\\n]*\\\"", "STRING_LITERAL", 131 },
+  { "\\'[^\\'\\n]\\'", "CHAR_LITERAL", 132 },
+  { "\\d+\\.\\d+", "FLOAT_LITERAL", 133 },
+  { "\\d+", "INT_LITERAL", 134 },
+  { "true|false", "BOOL_LITERAL", 135 },
+
+  // Comments and whitespace (150-159)
+  { "#[^\n]*", "COMMENT", 150 },
+  { "\\s+", "WHITESPACE", 151 },
+
+  // Identifier must be last
+  { "[a-zA-Z][a-zA-Z0-9_]*", "IDENTIFIER", INT_MAX }
+};
+
+#endif